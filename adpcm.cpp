@@ -0,0 +1,87 @@
+#include "adpcm.h"
+
+static const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static const int16_t STEP_TABLE[89] = {
+      7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+     19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+     50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+   2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+   5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Застосовує код до стану; спільне для кодера і декодера
+static int16_t applyCode(AdpcmState& state, uint8_t code) {
+  int step = STEP_TABLE[state.index];
+  int delta = step >> 3;
+
+  if (code & 4) delta += step;
+  if (code & 2) delta += step >> 1;
+  if (code & 1) delta += step >> 2;
+
+  int predictor = state.predictor + ((code & 8) ? -delta : delta);
+  if (predictor > 32767) predictor = 32767;
+  if (predictor < -32768) predictor = -32768;
+  state.predictor = (int16_t)predictor;
+
+  int index = state.index + INDEX_TABLE[code & 7];
+  if (index < 0) index = 0;
+  if (index > 88) index = 88;
+  state.index = (uint8_t)index;
+
+  return state.predictor;
+}
+
+static uint8_t encodeSample(AdpcmState& state, int16_t sample) {
+  int step = STEP_TABLE[state.index];
+  int diff = sample - state.predictor;
+  uint8_t code = 0;
+
+  if (diff < 0) {
+    code = 8;
+    diff = -diff;
+  }
+  if (diff >= step) {
+    code |= 4;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 2;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 1;
+  }
+
+  applyCode(state, code);
+  return code;
+}
+
+void adpcmReset(AdpcmState& state) {
+  state.predictor = 0;
+  state.index = 0;
+}
+
+void adpcmEncode(AdpcmState& state, const int16_t* pcm, size_t count, uint8_t* out) {
+  for (size_t i = 0; i < count; i += 2) {
+    uint8_t low = encodeSample(state, pcm[i]);
+    uint8_t high = (i + 1 < count) ? encodeSample(state, pcm[i + 1]) : 0;
+    out[i / 2] = low | (high << 4);
+  }
+}
+
+void adpcmDecode(AdpcmState& state, const uint8_t* in, size_t count, int16_t* pcm) {
+  for (size_t i = 0; i < count; i += 2) {
+    uint8_t packed = in[i / 2];
+    pcm[i] = applyCode(state, packed & 0x0F);
+    if (i + 1 < count) {
+      pcm[i + 1] = applyCode(state, packed >> 4);
+    }
+  }
+}
\ No newline at end of file
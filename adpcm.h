@@ -0,0 +1,25 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= IMA-ADPCM =============
+// 4 біти на семпл, молодший ніббл першим.
+// Не залежить від Arduino, як і synth.h.
+
+struct AdpcmState {
+  int16_t predictor;
+  uint8_t index;
+};
+
+// Кількість байтів для count семплів
+inline size_t adpcmPackedSize(size_t count) {
+  return (count + 1) / 2;
+}
+
+void adpcmReset(AdpcmState& state);
+void adpcmEncode(AdpcmState& state, const int16_t* pcm, size_t count, uint8_t* out);
+void adpcmDecode(AdpcmState& state, const uint8_t* in, size_t count, int16_t* pcm);
+
+#endif // ADPCM_H
\ No newline at end of file
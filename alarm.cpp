@@ -1,8 +1,18 @@
 #include "alarm.h"
 
-AlarmManager::AlarmManager() 
-  : alarmHour(9), alarmMinute(0), alarmEnabled(true), 
-    alarmTriggered(false), lastAlarmDay(-1) {
+AlarmManager::AlarmManager(Storage* stor)
+  : storage(stor), lock(NULL), lastCheck(0), ringingId(0),
+    nextHour(0), nextMinute(0), anyEnabled(false), nextFireAt(ALARM_NO_FIRE) {
+}
+
+void AlarmManager::begin() {
+  lock = xSemaphoreCreateMutex();
+
+  AlarmRule rules[ALARM_SLOTS];
+  uint8_t count = storage->loadAlarms(rules, ALARM_SLOTS);
+  // До синхронізації годинника розклад приблизний, checkAlarm() перерахує
+  schedule.load(rules, count, currentTime());
+  refresh();
 }
 
 void AlarmManager::setupI2S() {
@@ -13,8 +23,8 @@ void AlarmManager::setupI2S() {
     .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
     .communication_format = I2S_COMM_FORMAT_I2S_MSB,
     .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-    .dma_buf_count = 8,
-    .dma_buf_len = 256,
+    .dma_buf_count = I2S_DMA_BUF_COUNT,
+    .dma_buf_len = I2S_DMA_BUF_LEN,
     .use_apll = false,
     .tx_desc_auto_clear = true,
     .fixed_mclk = 0
@@ -27,73 +37,149 @@ void AlarmManager::setupI2S() {
     .data_in_num = I2S_PIN_NO_CHANGE
   };
 
-  i2s_driver_install(I2S_NUM_0, &config, 0, NULL);
+  QueueHandle_t i2sEvents = NULL;
+  i2s_driver_install(I2S_NUM_0, &config, I2S_EVENT_QUEUE_LENGTH, &i2sEvents);
   i2s_set_pin(I2S_NUM_0, &pin_config);
   i2s_zero_dma_buffer(I2S_NUM_0);
+
+  audio.begin(i2sEvents);
 }
 
-void AlarmManager::playAlarmSound() {
-  // 3 короткі сигнали
-  for (int j = 0; j < 3; j++) {
-    int samples = I2S_SAMPLE_RATE * 200 / 1000;  // 200мс на сигнал
-    for (int i = 0; i < samples; i++) {
-      int16_t sample = (int16_t)(sin(i * (2.0 * M_PI * I2S_BEEP_FREQ) / I2S_SAMPLE_RATE) * 15000);
-      size_t bytes_written;
-      i2s_write(I2S_NUM_0, (const char *)&sample, sizeof(sample), &bytes_written, portMAX_DELAY);
-    }
-    
-    // Пауза 100мс між сигналами
-    if (j < 2) {
-      delay(100);
-    }
+uint32_t AlarmManager::currentTime() const {
+  return (uint32_t)time(NULL);
+}
+
+void AlarmManager::refresh() {
+  int8_t index = schedule.getNextIndex();
+  anyEnabled = index >= 0;
+  if (anyEnabled) {
+    nextHour = schedule[index].hour;
+    nextMinute = schedule[index].minute;
+    nextFireAt = schedule.getFireAt(index);
+  } else {
+    nextFireAt = ALARM_NO_FIRE;
   }
 }
 
-void AlarmManager::checkAlarm(NTPClient& timeClient) {
-  if (!alarmEnabled) return;
- 
-  time_t epochTime = timeClient.getEpochTime();
-  struct tm * timeinfo = gmtime(&epochTime);
- 
-  int currentHour = timeinfo->tm_hour;
-  int currentMinute = timeinfo->tm_min;
-  int currentDay = timeinfo->tm_yday;
- 
-  if (currentDay != lastAlarmDay) {
-    alarmTriggered = false;
+void AlarmManager::save() {
+  AlarmRule rules[ALARM_SLOTS];
+  uint8_t count = schedule.size();
+  for (uint8_t i = 0; i < count; i++) {
+    rules[i] = schedule[i];
+  }
+  storage->saveAlarms(rules, count);
+}
+
+void AlarmManager::checkAlarm(time_t now) {
+  if (now < CLOCK_VALID_EPOCH) return;
+
+  // Перша синхронізація або стрибок годинника: пропущене не дзвонить
+  uint32_t current = (uint32_t)now;
+  if (lastCheck == 0 || current < lastCheck || current - lastCheck > ALARM_CLOCK_JUMP_SECONDS) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    schedule.reschedule(current);
+    refresh();
+    xSemaphoreGive(lock);
+  }
+  lastCheck = current;
+
+  if (current < schedule.getDue()) return;
+
+  bool changed;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint8_t id = schedule.poll(current, changed);
+  refresh();
+  xSemaphoreGive(lock);
+
+  if (changed) {
+    save();
   }
- 
-  if (currentHour == alarmHour && currentMinute == alarmMinute && !alarmTriggered) {
-    playAlarmSound();
-    alarmTriggered = true;
-    lastAlarmDay = currentDay;
+  if (id != 0) {
+    // Лише ставимо команду в чергу аудіозадачі, loop() не блокується.
+    // Без завантаженої мелодії аудіозадача грає стандартний сигнал.
+    ringingId = id;
+    audio.playRingtone(ALARM_RING_LOOPS);
   }
 }
 
-void AlarmManager::setTime(int hour, int minute) {
-  if (hour >= 0 && hour <= 23) {
-    alarmHour = hour;
+uint8_t AlarmManager::reserveId() {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint8_t id = schedule.reserveId();
+  xSemaphoreGive(lock);
+  return id;
+}
+
+uint8_t AlarmManager::addAlarm(uint8_t reserved, uint8_t hour, uint8_t minute, uint8_t days, bool enabled) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint8_t id = schedule.add(reserved, hour, minute, days, enabled, currentTime());
+  refresh();
+  xSemaphoreGive(lock);
+
+  if (id != 0) {
+    save();
   }
-  if (minute >= 0 && minute <= 59) {
-    alarmMinute = minute;
+  return id;
+}
+
+bool AlarmManager::removeAlarm(uint8_t id) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool removed = schedule.remove(id);
+  refresh();
+  xSemaphoreGive(lock);
+
+  if (removed) {
+    if (ringingId == id) {
+      stopRinging();
+    }
+    save();
   }
-  alarmTriggered = false;
+  return removed;
 }
 
-void AlarmManager::setEnabled(bool enabled) {
-  alarmEnabled = enabled;
-  if (!alarmEnabled) {
-    alarmTriggered = false;
+bool AlarmManager::updateAlarm(uint8_t id, bool enabled, bool skip) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool found = schedule.update(id, enabled, skip, currentTime());
+  refresh();
+  xSemaphoreGive(lock);
+
+  if (found) {
+    if (!enabled && ringingId == id) {
+      stopRinging();
+    }
+    save();
   }
+  return found;
 }
 
-void AlarmManager::toggleEnabled() {
-  alarmEnabled = !alarmEnabled;
-  if (!alarmEnabled) {
-    alarmTriggered = false;
+uint8_t AlarmManager::getAlarms(AlarmRule* rules, uint32_t* fireAt, uint8_t maxCount) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint8_t count = min(schedule.size(), maxCount);
+  for (uint8_t i = 0; i < count; i++) {
+    rules[i] = schedule[i];
+    fireAt[i] = schedule.getFireAt(i);
   }
+  xSemaphoreGive(lock);
+  return count;
+}
+
+void AlarmManager::snooze() {
+  audio.stop();
+  if (ringingId == 0 || lastCheck == 0) return;
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  schedule.snooze(ringingId, lastCheck, ALARM_SNOOZE_SECONDS);
+  xSemaphoreGive(lock);
+}
+
+void AlarmManager::stopRinging() {
+  audio.stop();
+  ringingId = 0;
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  schedule.cancelSnooze();
+  xSemaphoreGive(lock);
 }
 
-void AlarmManager::resetTriggered() {
-  alarmTriggered = false;
+void AlarmManager::previewRingtone() {
+  audio.playRingtone(1);
 }
\ No newline at end of file
@@ -3,36 +3,70 @@
 
 #include <Arduino.h>
 #include <driver/i2s.h>
-#include <NTPClient.h>
 #include "config.h"
+#include "audio.h"
+#include "storage.h"
+#include "alarm_schedule.h"
 
+// Кілька будильників з днями тижня. Розклад змінює і перевіряє лише
+// задача UI; задача "net" читає знімок списку під м'ютексом.
 class AlarmManager {
 private:
-  int alarmHour;
-  int alarmMinute;
-  bool alarmEnabled;
-  bool alarmTriggered;
-  int lastAlarmDay;
-  
-  void playAlarmSound();
+  Storage* storage;
+  AlarmSchedule schedule;
+  SemaphoreHandle_t lock;
+  uint32_t lastCheck;     // 0 - годинник ще не синхронізовано
+  uint8_t ringingId;      // останній, що дзвонив - його відкладає snooze()
+
+  // Найближчий увімкнений - для екрана налаштувань і /status
+  int nextHour;
+  int nextMinute;
+  bool anyEnabled;
+  uint32_t nextFireAt;
+
+  AudioManager audio;
+
+  void refresh();
+  void save();
+  uint32_t currentTime() const;
 
 public:
-  AlarmManager();
-  
+  AlarmManager(Storage* stor);
+
+  // Правила зі Storage; після storage.begin()
+  void begin();
   void setupI2S();
-  void checkAlarm(NTPClient& timeClient);
-  
+  // Щосекунди: поки не настав найближчий, лише одне порівняння
+  void checkAlarm(time_t now);
+
+  // Можна з будь-якої задачі: id, під яким addAlarm() додасть будильник,
+  // щоб віддати його клієнту до того, як задача UI обробить запит
+  uint8_t reserveId();
+  // id нового (reserved, якщо вільний), 0 - список повний або невірний час
+  uint8_t addAlarm(uint8_t reserved, uint8_t hour, uint8_t minute, uint8_t days, bool enabled);
+  bool removeAlarm(uint8_t id);
+  // Увімкнення і пропуск разом: один перерахунок і один запис
+  bool updateAlarm(uint8_t id, bool enabled, bool skip);
+
+  // Знімок списку для інших задач; fireAt - ALARM_NO_FIRE для вимкнених
+  uint8_t getAlarms(AlarmRule* rules, uint32_t* fireAt, uint8_t maxCount);
+
   // Getters
-  int getHour() const { return alarmHour; }
-  int getMinute() const { return alarmMinute; }
-  bool isEnabled() const { return alarmEnabled; }
-  bool isTriggered() const { return alarmTriggered; }
-  
-  // Setters
-  void setTime(int hour, int minute);
-  void setEnabled(bool enabled);
-  void toggleEnabled();
-  void resetTriggered();
+  int getHour() const { return nextHour; }
+  int getMinute() const { return nextMinute; }
+  bool isEnabled() const { return anyEnabled; }
+  uint32_t getNextFire() const { return nextFireAt; }
+  uint32_t getSnoozeUntil() const { return schedule.getSnoozeUntil(); }
+  // Дзвонить або відкладений
+  bool isTriggered() const { return audio.isPlaying() || schedule.getSnoozeUntil() != 0; }
+  bool isRinging() const { return audio.isPlaying(); }
+  uint32_t getAudioUnderruns() const { return audio.getUnderruns(); }
+
+  // Замовк і повториться через ALARM_SNOOZE_SECONDS
+  void snooze();
+  // Замовк остаточно, відкладений теж скасовано
+  void stopRinging();
+  void previewRingtone();
 };
 
 #endif // ALARM_H
\ No newline at end of file
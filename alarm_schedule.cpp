@@ -0,0 +1,282 @@
+#include "alarm_schedule.h"
+#include <string.h>
+#include <time.h>
+
+// Днів уперед, щоб знайти будь-який день тижня
+#define ALARM_SEARCH_DAYS 8
+
+static bool isValidRule(const AlarmRule& rule) {
+  return rule.id != 0 && rule.hour < 24 && rule.minute < 60 && rule.days <= ALARM_EVERY_DAY;
+}
+
+// Місцевий час candidate у UTC. Який з двох проходів осінньої години
+// дає mktime() з tm_isdst = -1, залежить від бібліотеки (glibc і newlib
+// вибирають по-різному), тож беремо найранніший, що ще після after
+static time_t resolveLocal(struct tm& candidate, time_t after) {
+  int hour = candidate.tm_hour;
+  int minute = candidate.tm_min;
+  candidate.tm_isdst = -1;
+  time_t when = mktime(&candidate);
+  if (when == (time_t)-1) return when;
+
+  for (int shift = -1; shift <= 1; shift += 2) {
+    time_t other = when + shift * 3600;
+    if (other <= after || (shift > 0 && when > after)) continue;
+
+    struct tm check;
+    localtime_r(&other, &check);
+    if (check.tm_mday == candidate.tm_mday && check.tm_hour == hour && check.tm_min == minute) {
+      candidate = check;
+      return other;
+    }
+  }
+  return when;
+}
+
+uint32_t alarmNextFire(const AlarmRule& rule, uint32_t after, uint32_t lastFired) {
+  time_t base = after;
+  struct tm local;
+  localtime_r(&base, &local);
+
+  struct tm fired;
+  if (lastFired != 0) {
+    time_t firedTime = lastFired;
+    localtime_r(&firedTime, &fired);
+  }
+
+  // Сьогодні - лише якщо годинник ще не дійшов до часу будильника:
+  // так зсунутий весною час не дзвонить вдруге
+  int16_t nowMinutes = local.tm_hour * 60 + local.tm_min;
+  int16_t alarmMinutes = rule.hour * 60 + rule.minute;
+
+  for (uint8_t day = 0; day < ALARM_SEARCH_DAYS; day++) {
+    if (day == 0 && nowMinutes >= alarmMinutes) continue;
+
+    // mktime() сам переносить день через кінець місяця і року
+    struct tm candidate = local;
+    candidate.tm_mday += day;
+    candidate.tm_hour = rule.hour;
+    candidate.tm_min = rule.minute;
+    candidate.tm_sec = 0;
+    time_t when = resolveLocal(candidate, base);
+    if (when == (time_t)-1 || when <= base) continue;
+    if (lastFired != 0 && candidate.tm_year == fired.tm_year && candidate.tm_yday == fired.tm_yday) continue;
+
+    if (rule.days == 0 || (rule.days & (1 << candidate.tm_wday))) {
+      return (uint32_t)when;
+    }
+  }
+  return ALARM_NO_FIRE;
+}
+
+AlarmSchedule::AlarmSchedule()
+  : count(0), heapSize(0), lastId(0), snoozeUntil(0), snoozedId(0), due(ALARM_NO_FIRE) {
+  memset(rules, 0, sizeof(rules));
+  for (uint8_t i = 0; i < ALARM_SLOTS; i++) {
+    fireAt[i] = ALARM_NO_FIRE;
+    firedAt[i] = 0;
+  }
+}
+
+void AlarmSchedule::siftDown(uint8_t pos) {
+  while (true) {
+    uint8_t smallest = pos;
+    uint8_t left = 2 * pos + 1;
+    uint8_t right = left + 1;
+    if (left < heapSize && lessAt(left, smallest)) smallest = left;
+    if (right < heapSize && lessAt(right, smallest)) smallest = right;
+    if (smallest == pos) return;
+
+    uint8_t swap = heap[pos];
+    heap[pos] = heap[smallest];
+    heap[smallest] = swap;
+    pos = smallest;
+  }
+}
+
+void AlarmSchedule::rebuildHeap() {
+  heapSize = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (fireAt[i] != ALARM_NO_FIRE) {
+      heap[heapSize++] = i;
+    }
+  }
+  for (int8_t i = heapSize / 2 - 1; i >= 0; i--) {
+    siftDown(i);
+  }
+  updateDue();
+}
+
+void AlarmSchedule::updateDue() {
+  due = heapSize > 0 ? fireAt[heap[0]] : ALARM_NO_FIRE;
+  if (snoozeUntil != 0 && snoozeUntil < due) {
+    due = snoozeUntil;
+  }
+}
+
+int8_t AlarmSchedule::indexOf(uint8_t id) const {
+  for (uint8_t i = 0; i < count; i++) {
+    if (rules[i].id == id) return i;
+  }
+  return -1;
+}
+
+uint8_t AlarmSchedule::allocateId() const {
+  // Після видаленого id не повертається одразу, щоб запит до
+  // старого будильника не влучив у новий
+  uint8_t id = lastId;
+  for (uint16_t tries = 0; tries < 255; tries++) {
+    id = id == 255 ? 1 : id + 1;
+    if (indexOf(id) < 0) return id;
+  }
+  return 0;
+}
+
+uint32_t AlarmSchedule::nextFireOf(uint8_t index, uint32_t now) const {
+  if (!(rules[index].flags & ALARM_ENABLED)) return ALARM_NO_FIRE;
+  return alarmNextFire(rules[index], now, firedAt[index]);
+}
+
+void AlarmSchedule::load(const AlarmRule* source, uint8_t sourceCount, uint32_t now) {
+  count = 0;
+  lastId = 0;
+  for (uint8_t i = 0; i < sourceCount && count < ALARM_SLOTS; i++) {
+    if (!isValidRule(source[i]) || indexOf(source[i].id) >= 0) continue;
+    rules[count] = source[i];
+    rules[count].flags &= ALARM_ENABLED | ALARM_SKIP_NEXT;
+    if (rules[count].id > lastId) lastId = rules[count].id;
+    firedAt[count] = 0;
+    count++;
+  }
+  snoozeUntil = 0;
+  snoozedId = 0;
+  reschedule(now);
+}
+
+void AlarmSchedule::reschedule(uint32_t now) {
+  for (uint8_t i = 0; i < count; i++) {
+    fireAt[i] = nextFireOf(i, now);
+  }
+  // Відкладений, що вже мав продзвонити, не дзвонить запізно
+  if (snoozeUntil != 0 && snoozeUntil <= now) {
+    snoozeUntil = 0;
+    snoozedId = 0;
+  }
+  rebuildHeap();
+}
+
+uint8_t AlarmSchedule::reserveId() {
+  uint8_t id = allocateId();
+  if (id != 0) {
+    lastId = id;
+  }
+  return id;
+}
+
+uint8_t AlarmSchedule::add(uint8_t id, uint8_t hour, uint8_t minute, uint8_t days, bool enabled, uint32_t now) {
+  if (count >= ALARM_SLOTS || hour >= 24 || minute >= 60 || days > ALARM_EVERY_DAY) return 0;
+
+  // Зарезервований id уже врахований у lastId
+  if (id == 0 || indexOf(id) >= 0) {
+    id = reserveId();
+  }
+  if (id == 0) return 0;
+
+  AlarmRule& rule = rules[count];
+  rule.id = id;
+  rule.hour = hour;
+  rule.minute = minute;
+  rule.days = days;
+  rule.flags = enabled ? ALARM_ENABLED : 0;
+  firedAt[count] = 0;
+  fireAt[count] = nextFireOf(count, now);
+  count++;
+  rebuildHeap();
+  return id;
+}
+
+bool AlarmSchedule::remove(uint8_t id) {
+  int8_t index = indexOf(id);
+  if (index < 0) return false;
+
+  // Порядок правил зберігається - список у веб-панелі не перестрибує
+  for (uint8_t i = index; i + 1 < count; i++) {
+    rules[i] = rules[i + 1];
+    fireAt[i] = fireAt[i + 1];
+    firedAt[i] = firedAt[i + 1];
+  }
+  count--;
+  if (snoozedId == id) {
+    snoozeUntil = 0;
+    snoozedId = 0;
+  }
+  rebuildHeap();
+  return true;
+}
+
+bool AlarmSchedule::update(uint8_t id, bool enabled, bool skip, uint32_t now) {
+  int8_t index = indexOf(id);
+  if (index < 0) return false;
+
+  AlarmRule& rule = rules[index];
+  bool wasEnabled = (rule.flags & ALARM_ENABLED) != 0;
+  rule.flags = 0;
+  if (enabled) {
+    // Пропуск не зсуває час: він спрацьовує разом із ним
+    rule.flags = ALARM_ENABLED | (skip ? ALARM_SKIP_NEXT : 0);
+  } else if (snoozedId == id) {
+    snoozeUntil = 0;
+    snoozedId = 0;
+  }
+  if (enabled != wasEnabled) {
+    fireAt[index] = nextFireOf(index, now);
+  }
+  rebuildHeap();
+  return true;
+}
+
+void AlarmSchedule::snooze(uint8_t id, uint32_t now, uint32_t seconds) {
+  snoozedId = id;
+  snoozeUntil = now + seconds;
+  updateDue();
+}
+
+uint8_t AlarmSchedule::poll(uint32_t now, bool& changed) {
+  changed = false;
+  if (now < due) return 0;
+
+  if (snoozeUntil != 0 && now >= snoozeUntil) {
+    uint8_t id = snoozedId;
+    snoozeUntil = 0;
+    snoozedId = 0;
+    updateDue();
+    return id;
+  }
+
+  // Вершина купи: наступне спрацювання або вимкнення одноразового
+  uint8_t index = heap[0];
+  AlarmRule& rule = rules[index];
+  firedAt[index] = fireAt[index];
+  bool skipped = (rule.flags & ALARM_SKIP_NEXT) != 0;
+  if (skipped) {
+    rule.flags &= ~ALARM_SKIP_NEXT;
+    changed = true;
+  }
+
+  if (rule.days == 0) {
+    rule.flags &= ~ALARM_ENABLED;
+    fireAt[index] = ALARM_NO_FIRE;
+    heap[0] = heap[--heapSize];
+    changed = true;
+  } else {
+    fireAt[index] = nextFireOf(index, now);
+  }
+  siftDown(0);
+  updateDue();
+
+  return skipped ? 0 : rule.id;
+}
+
+uint32_t AlarmSchedule::getFireAt(uint8_t index) const {
+  return index < count ? fireAt[index] : ALARM_NO_FIRE;
+}
\ No newline at end of file
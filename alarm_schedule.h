@@ -0,0 +1,102 @@
+#ifndef ALARM_SCHEDULE_H
+#define ALARM_SCHEDULE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= РОЗКЛАД БУДИЛЬНИКІВ =============
+// Кожен будильник знає час наступного спрацювання (UTC, с), увімкнені
+// лежать у мінімальній купі за цим часом. Перевірка щосекунди - одне
+// порівняння з вершиною, а вершина ж і є наступним моментом пробудження.
+// Час будильника - місцевий: дата і перехід на літній час - за
+// localtime_r()/mktime() з поточною TZ.
+// Не залежить від Arduino, тож розклад можна ганяти на ПК.
+
+#define ALARM_SLOTS     8
+#define ALARM_EVERY_DAY 0x7F   // усі біти днів тижня
+#define ALARM_WEEKDAYS  0x3E   // пн-пт
+#define ALARM_NO_FIRE   UINT32_MAX
+
+enum AlarmFlags : uint8_t {
+  ALARM_ENABLED   = 0x01,
+  ALARM_SKIP_NEXT = 0x02   // найближче спрацювання пропустити
+};
+
+// Правило, як воно зберігається у флеші
+struct AlarmRule {
+  uint8_t id;       // 1..255, 0 - слот вільний
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t days;     // біт на день, 1 << tm_wday (0 - неділя); 0 - одноразовий
+  uint8_t flags;    // AlarmFlags
+};
+
+// Перший момент після after, коли правило має спрацювати, незалежно
+// від ALARM_ENABLED. Час, якого через перехід на літній немає, зсувається
+// вперед; з двох проходів осінньої години - ранній.
+// lastFired - попереднє спрацювання, 0 - не було: у його місцеву дату
+// правило вже не спрацьовує, тож осінній повтор години не дзвонить
+// вдруге, навіть якщо розклад перераховано посеред повтору.
+uint32_t alarmNextFire(const AlarmRule& rule, uint32_t after, uint32_t lastFired = 0);
+
+class AlarmSchedule {
+private:
+  AlarmRule rules[ALARM_SLOTS];
+  uint32_t fireAt[ALARM_SLOTS];
+  uint32_t firedAt[ALARM_SLOTS];  // останнє спрацювання чи пропуск, 0 - не було, лише в RAM
+  uint8_t count;
+  uint8_t heap[ALARM_SLOTS];    // індекси rules, вершина - найближчий
+  uint8_t heapSize;
+  uint8_t lastId;
+
+  uint32_t snoozeUntil;         // 0 - не відкладено
+  uint8_t snoozedId;
+  uint32_t due;                 // найближче з вершини купи і snoozeUntil
+
+  bool lessAt(uint8_t a, uint8_t b) const { return fireAt[heap[a]] < fireAt[heap[b]]; }
+  void siftDown(uint8_t pos);
+  void rebuildHeap();
+  void updateDue();
+  int8_t indexOf(uint8_t id) const;
+  uint8_t allocateId() const;
+  uint32_t nextFireOf(uint8_t index, uint32_t now) const;
+
+public:
+  AlarmSchedule();
+
+  // Правила з флешу; невалідні відкидаються
+  void load(const AlarmRule* source, uint8_t sourceCount, uint32_t now);
+  // Перераховує всі спрацювання від now, напр. коли годинник стрибнув
+  void reschedule(uint32_t now);
+
+  // id для будильника, який буде додано пізніше: інша задача може
+  // віддати його клієнту одразу, ще до add()
+  uint8_t reserveId();
+  // id нового будильника (id, якщо він вільний, інакше новий),
+  // 0 - немає місця або невірний час
+  uint8_t add(uint8_t id, uint8_t hour, uint8_t minute, uint8_t days, bool enabled, uint32_t now);
+  bool remove(uint8_t id);
+  // Обидва прапорці разом, купа перебудовується один раз;
+  // вимкнений будильник пропуск не тримає
+  bool update(uint8_t id, bool enabled, bool skip, uint32_t now);
+
+  // Повторити будильник id через seconds; дзвонить лише один відкладений
+  void snooze(uint8_t id, uint32_t now, uint32_t seconds);
+  void cancelSnooze() { snoozeUntil = 0; snoozedId = 0; updateDue(); }
+
+  // Щосекунди з задачі UI. id будильника, що має дзвонити, 0 - жоден.
+  // changed - правила змінились (одноразовий вимкнувся, пропуск
+  // використано), їх треба зберегти
+  uint8_t poll(uint32_t now, bool& changed);
+
+  uint8_t size() const { return count; }
+  const AlarmRule& operator[](uint8_t index) const { return rules[index]; }
+  // Наступне спрацювання rules[index], ALARM_NO_FIRE - вимкнений
+  uint32_t getFireAt(uint8_t index) const;
+  // Індекс найближчого увімкненого, -1 - жодного
+  int8_t getNextIndex() const { return heapSize > 0 ? heap[0] : -1; }
+  uint32_t getDue() const { return due; }
+  uint32_t getSnoozeUntil() const { return snoozeUntil; }
+};
+
+#endif // ALARM_SCHEDULE_H
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "audio.h"
+
+// Гучність власної мелодії наростає так само, як у синтезатора
+static const SynthRamp RINGTONE_RAMP = {8000, 4000, SYNTH_Q15_ONE};
+
+static const SynthPattern* patternTable(AudioPattern pattern) {
+  switch (pattern) {
+    case AUDIO_PATTERN_MELODY:
+      return &SYNTH_PATTERN_MELODY;
+    case AUDIO_PATTERN_BEEP:
+    default:
+      return &SYNTH_PATTERN_BEEP;
+  }
+}
+
+AudioManager::AudioManager()
+  : commandQueue(NULL), i2sEvents(NULL), taskHandle(NULL),
+    playing(false), underruns(0), source(SOURCE_SYNTH),
+    synth(I2S_SAMPLE_RATE), ringtoneLoopsLeft(0), ringtoneGain(0),
+    buffersQueued(0), primed(false) {
+}
+
+void AudioManager::begin(QueueHandle_t i2sEventQueue) {
+  if (taskHandle != NULL) return;
+
+  i2sEvents = i2sEventQueue;
+  commandQueue = xQueueCreate(AUDIO_QUEUE_LENGTH, sizeof(AudioCommand));
+  xTaskCreate(taskEntry, "audio", AUDIO_TASK_STACK, this, AUDIO_TASK_PRIORITY, &taskHandle);
+}
+
+bool AudioManager::play(AudioPattern pattern, uint16_t loops) {
+  if (commandQueue == NULL) return false;
+
+  AudioCommand cmd = {AUDIO_CMD_PLAY_PATTERN, pattern, loops};
+  return xQueueSend(commandQueue, &cmd, 0) == pdTRUE;
+}
+
+bool AudioManager::playRingtone(uint16_t loops) {
+  if (commandQueue == NULL) return false;
+
+  AudioCommand cmd = {AUDIO_CMD_PLAY_RINGTONE, AUDIO_PATTERN_BEEP, loops};
+  return xQueueSend(commandQueue, &cmd, 0) == pdTRUE;
+}
+
+bool AudioManager::stop() {
+  if (commandQueue == NULL) return false;
+
+  AudioCommand cmd = {AUDIO_CMD_STOP, AUDIO_PATTERN_BEEP, 0};
+  return xQueueSend(commandQueue, &cmd, 0) == pdTRUE;
+}
+
+void AudioManager::taskEntry(void* arg) {
+  static_cast<AudioManager*>(arg)->taskLoop();
+}
+
+void AudioManager::taskLoop() {
+  AudioCommand cmd;
+
+  for (;;) {
+    // У спокої чекаємо команду, під час відтворення лише перевіряємо чергу
+    TickType_t wait = playing ? 0 : portMAX_DELAY;
+    if (xQueueReceive(commandQueue, &cmd, wait) == pdTRUE) {
+      handleCommand(cmd);
+    }
+
+    if (playing) {
+      trackUnderruns();
+      bool more = renderBlock();
+      size_t bytesWritten;
+      // Блокується лише аудіозадача, поки звільниться DMA-буфер
+      i2s_write(I2S_NUM_0, block, sizeof(block), &bytesWritten, portMAX_DELAY);
+      if (buffersQueued < I2S_DMA_BUF_COUNT) {
+        buffersQueued++;
+      }
+      if (buffersQueued == I2S_DMA_BUF_COUNT) {
+        primed = true;
+      }
+      if (!more) {
+        playing = false;
+      }
+    }
+  }
+}
+
+void AudioManager::handleCommand(const AudioCommand& cmd) {
+  switch (cmd.type) {
+    case AUDIO_CMD_PLAY_PATTERN:
+      ringtone.close();
+      source = SOURCE_SYNTH;
+      synth.start(patternTable(cmd.pattern), cmd.loops);
+      playing = synth.isActive();
+      break;
+
+    case AUDIO_CMD_PLAY_RINGTONE:
+      synth.stop();
+      if (ringtone.open()) {
+        source = SOURCE_RINGTONE;
+        ringtoneLoopsLeft = cmd.loops > 0 ? cmd.loops : 1;
+        ringtoneGain = RINGTONE_RAMP.startGain;
+        playing = true;
+      } else {
+        // Немає завантаженої мелодії - стандартний сигнал
+        source = SOURCE_SYNTH;
+        synth.start(&SYNTH_PATTERN_BEEP, cmd.loops);
+        playing = synth.isActive();
+      }
+      break;
+
+    case AUDIO_CMD_STOP:
+      synth.stop();
+      ringtone.close();
+      playing = false;
+      i2s_zero_dma_buffer(I2S_NUM_0);
+      break;
+  }
+
+  // Події від попереднього відтворення не мають рахуватися
+  if (playing && i2sEvents != NULL) {
+    xQueueReset(i2sEvents);
+    buffersQueued = 0;
+    primed = false;
+  }
+}
+
+bool AudioManager::renderBlock() {
+  if (source == SOURCE_RINGTONE) {
+    return renderRingtone();
+  }
+
+  synth.render(block, I2S_DMA_BUF_LEN);
+  return synth.isActive();
+}
+
+bool AudioManager::renderRingtone() {
+  size_t samples = ringtone.readBlock(block);
+
+  if (samples == 0) {
+    // Кінець кліпу: повтор або завершення
+    ringtoneLoopsLeft--;
+    if (ringtoneLoopsLeft == 0 || !ringtone.rewind()) {
+      ringtone.close();
+      memset(block, 0, sizeof(block));
+      return false;
+    }
+
+    ringtoneGain += RINGTONE_RAMP.stepGain;
+    if (ringtoneGain > RINGTONE_RAMP.maxGain) {
+      ringtoneGain = RINGTONE_RAMP.maxGain;
+    }
+    ringtone.readBlock(block);
+  }
+
+  for (int i = 0; i < I2S_DMA_BUF_LEN; i++) {
+    block[i] = (int16_t)((block[i] * ringtoneGain) >> 15);
+  }
+  return true;
+}
+
+void AudioManager::trackUnderruns() {
+  if (i2sEvents == NULL) return;
+
+  // Кожен TX_DONE - один відіграний DMA-буфер.
+  // Якщо після заповнення всіх буферів черга спорожніла, DMA грав тишу.
+  i2s_event_t event;
+  while (xQueueReceive(i2sEvents, &event, 0) == pdTRUE) {
+    if (event.type == I2S_EVENT_TX_DONE && buffersQueued > 0) {
+      buffersQueued--;
+      if (buffersQueued == 0 && primed) {
+        underruns++;
+        primed = false;
+      }
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include "config.h"
+#include "synth.h"
+#include "ringtone.h"
+
+// ============= КОМАНДИ АУДІОЗАДАЧІ =============
+enum AudioCommandType {
+  AUDIO_CMD_PLAY_PATTERN = 0,
+  AUDIO_CMD_STOP = 1,
+  AUDIO_CMD_PLAY_RINGTONE = 2
+};
+
+enum AudioPattern {
+  AUDIO_PATTERN_BEEP = 0,
+  AUDIO_PATTERN_MELODY = 1
+};
+
+struct AudioCommand {
+  AudioCommandType type;
+  AudioPattern pattern;
+  uint16_t loops;
+};
+
+// Фонова задача відтворення: отримує команди через чергу
+// і пише в I2S блоками розміром з DMA-буфер
+class AudioManager {
+private:
+  enum Source {
+    SOURCE_SYNTH = 0,
+    SOURCE_RINGTONE
+  };
+
+  QueueHandle_t commandQueue;
+  QueueHandle_t i2sEvents;
+  TaskHandle_t taskHandle;
+  volatile bool playing;
+  volatile uint32_t underruns;
+
+  int16_t block[I2S_DMA_BUF_LEN];
+  Source source;
+  Synth synth;
+  RingtoneReader ringtone;
+  uint16_t ringtoneLoopsLeft;
+  int32_t ringtoneGain;  // Q15
+
+  // DMA-буфери, записані, але ще не відіграні
+  uint8_t buffersQueued;
+  bool primed;
+
+  static void taskEntry(void* arg);
+  void taskLoop();
+  void handleCommand(const AudioCommand& cmd);
+  bool renderBlock();
+  bool renderRingtone();
+  void trackUnderruns();
+
+public:
+  AudioManager();
+
+  void begin(QueueHandle_t i2sEventQueue);
+  bool play(AudioPattern pattern, uint16_t loops = 1);
+  bool playRingtone(uint16_t loops = 1);
+  bool stop();
+  bool isPlaying() const { return playing; }
+  uint32_t getUnderruns() const { return underruns; }
+};
+
+#endif // AUDIO_H
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "button.h"
+
+ButtonManager::ButtonManager(uint8_t buttonPin, ButtonQueue* queue, Scheduler* sched)
+  : pin(buttonPin), out(queue), scheduler(sched),
+    debounceTimer(NULL), holdTimer(NULL), repeatTimer(NULL),
+    firstEdgeUs(0), edgePending(false), edgeCount(0),
+    pressed(false), longSent(false), clicks(0), repeats(0),
+    pressUs(0), lastClickUs(0) {
+}
+
+void ButtonManager::begin() {
+  if (debounceTimer != NULL) return;
+
+  pinMode(pin, INPUT_PULLUP);
+
+  esp_timer_create_args_t args = {};
+  args.arg = this;
+  args.dispatch_method = ESP_TIMER_TASK;
+
+  args.callback = debounceEntry;
+  args.name = "btn_debounce";
+  esp_timer_create(&args, &debounceTimer);
+
+  args.callback = holdEntry;
+  args.name = "btn_hold";
+  esp_timer_create(&args, &holdTimer);
+
+  args.callback = repeatEntry;
+  args.name = "btn_repeat";
+  esp_timer_create(&args, &repeatTimer);
+
+  attachInterruptArg(digitalPinToInterrupt(pin), isrEntry, this, CHANGE);
+}
+
+void IRAM_ATTR ButtonManager::isrEntry(void* arg) {
+  static_cast<ButtonManager*>(arg)->onEdge();
+}
+
+void IRAM_ATTR ButtonManager::onEdge() {
+  // Час жесту - перший фронт, а не момент, коли брязкіт ущух
+  if (!edgePending) {
+    firstEdgeUs = esp_timer_get_time();
+    edgePending = true;
+  }
+  edgeCount++;
+
+  // Кожен новий фронт відсуває перевірку рівня
+  esp_timer_stop(debounceTimer);
+  esp_timer_start_once(debounceTimer, (uint64_t)BUTTON_DEBOUNCE_DELAY * 1000);
+}
+
+void ButtonManager::debounceEntry(void* arg) {
+  static_cast<ButtonManager*>(arg)->onStable();
+}
+
+void ButtonManager::holdEntry(void* arg) {
+  static_cast<ButtonManager*>(arg)->onHold();
+}
+
+void ButtonManager::repeatEntry(void* arg) {
+  static_cast<ButtonManager*>(arg)->onRepeat();
+}
+
+void ButtonManager::onStable() {
+  int64_t edgeUs = firstEdgeUs;
+  edgePending = false;
+
+  bool down = digitalRead(pin) == LOW;
+  if (down == pressed) return;  // Брязкіт повернув кнопку в попередній стан
+  pressed = down;
+
+  if (down) {
+    pressUs = edgeUs;
+    longSent = false;
+    repeats = 0;
+    emit(BUTTON_EVENT_DOWN, edgeUs);
+    esp_timer_start_once(holdTimer, (uint64_t)BUTTON_LONG_PRESS_TIME * 1000);
+    return;
+  }
+
+  esp_timer_stop(holdTimer);
+  esp_timer_stop(repeatTimer);
+  emit(BUTTON_EVENT_UP, edgeUs);
+
+  if (longSent) {
+    clicks = 0;
+    return;
+  }
+
+  // SHORT не чекає на можливий другий клік, тож не додає затримки;
+  // другий швидкий клік приходить як DOUBLE замість ще одного SHORT
+  if (clicks == 1 && edgeUs - lastClickUs <= (int64_t)BUTTON_DOUBLE_CLICK_TIME * 1000) {
+    clicks = 0;
+    emit(BUTTON_EVENT_DOUBLE, edgeUs);
+  } else {
+    clicks = 1;
+    lastClickUs = edgeUs;
+    emit(BUTTON_EVENT_SHORT, edgeUs);
+  }
+}
+
+void ButtonManager::onHold() {
+  if (!pressed) return;
+
+  longSent = true;
+  emit(BUTTON_EVENT_LONG, pressUs);
+  esp_timer_start_periodic(repeatTimer, (uint64_t)BUTTON_REPEAT_INTERVAL * 1000);
+}
+
+void ButtonManager::onRepeat() {
+  if (!pressed) {
+    esp_timer_stop(repeatTimer);
+    return;
+  }
+
+  repeats++;
+  emit(BUTTON_EVENT_REPEAT, esp_timer_get_time());
+}
+
+void ButtonManager::emit(ButtonEventType type, int64_t edgeUs) {
+  ButtonEvent event = {type, repeats, edgeUs};
+  if (out->push(event)) {
+    scheduler->post(SCHED_EVENT_BUTTON);
+  }
+}
\ No newline at end of file
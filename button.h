@@ -0,0 +1,71 @@
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "config.h"
+#include "spsc_queue.h"
+#include "scheduler.h"
+
+enum ButtonEventType : uint8_t {
+  BUTTON_EVENT_DOWN,    // стабільне натискання після брязкоту
+  BUTTON_EVENT_UP,      // стабільне відпускання
+  BUTTON_EVENT_SHORT,   // клік; видається одразу при відпусканні
+  BUTTON_EVENT_DOUBLE,  // другий клік у межах BUTTON_DOUBLE_CLICK_TIME замість SHORT
+  BUTTON_EVENT_LONG,    // утримання BUTTON_LONG_PRESS_TIME
+  BUTTON_EVENT_REPEAT   // далі кожні BUTTON_REPEAT_INTERVAL, поки кнопку тримають
+};
+
+struct ButtonEvent {
+  ButtonEventType type;
+  uint8_t repeat;   // номер повтору для BUTTON_EVENT_REPEAT
+  int64_t edgeUs;   // перший фронт, з якого почався жест, esp_timer_get_time()
+};
+
+typedef SpscQueue<ButtonEvent, BUTTON_QUEUE_LENGTH> ButtonQueue;
+
+// Переривання GPIO лише запам'ятовує фронт і перезапускає таймер брязкоту.
+// Стабільний рівень і жести розбирають колбеки esp_timer - вони всі
+// в одній задачі esp_timer, тож вона єдиний виробник черги подій.
+class ButtonManager {
+private:
+  uint8_t pin;
+  ButtonQueue* out;
+  Scheduler* scheduler;
+
+  esp_timer_handle_t debounceTimer;
+  esp_timer_handle_t holdTimer;
+  esp_timer_handle_t repeatTimer;
+
+  volatile int64_t firstEdgeUs;
+  volatile bool edgePending;
+  volatile uint32_t edgeCount;
+
+  bool pressed;
+  bool longSent;
+  uint8_t clicks;
+  uint8_t repeats;
+  int64_t pressUs;
+  int64_t lastClickUs;
+
+  static void IRAM_ATTR isrEntry(void* arg);
+  static void debounceEntry(void* arg);
+  static void holdEntry(void* arg);
+  static void repeatEntry(void* arg);
+
+  void IRAM_ATTR onEdge();
+  void onStable();
+  void onHold();
+  void onRepeat();
+  void emit(ButtonEventType type, int64_t edgeUs);
+
+public:
+  ButtonManager(uint8_t buttonPin, ButtonQueue* queue, Scheduler* sched);
+
+  void begin();
+
+  // Скільки фронтів (разом з брязкотом) бачило переривання
+  uint32_t getEdgeCount() const { return edgeCount; }
+};
+
+#endif // BUTTON_H
\ No newline at end of file
@@ -28,36 +28,156 @@
 #define I2S_SAMPLE_RATE   16000
 #define I2S_BEEP_FREQ     1000
 #define I2S_BEEP_MS       500
+#define I2S_DMA_BUF_COUNT 8
+#define I2S_DMA_BUF_LEN   256   // семплів у DMA-буфері = розмір блоку аудіозадачі
+
+// ============= АУДІОЗАДАЧА =============
+#define AUDIO_TASK_STACK     4096
+#define AUDIO_TASK_PRIORITY  2     // вище за loop(), щоб DMA не голодував
+#define AUDIO_QUEUE_LENGTH   4
+#define ALARM_RING_LOOPS     20    // повторів патерну, поки будильник не вимкнуть
+#define ALARM_SNOOZE_SECONDS 540   // коротке натискання під час дзвінка - ще раз через 9 хв
+#define ALARM_CLOCK_JUMP_SECONDS 300  // годинник стрибнув далі - розклад рахується заново
+#define I2S_EVENT_QUEUE_LENGTH 16  // події TX_DONE для лічильника underrun
+
+// ============= МЕЛОДІЯ ДЗВІНКА =============
+#define RINGTONE_PATH         "/ringtone.adp"
+#define RINGTONE_UPLOAD_PATH  "/ringtone.tmp"
+#define RINGTONE_MAX_SECONDS  30
+
+// ============= ІСТОРІЯ ДАТЧИКА =============
+#define HISTORY_PATH_FORMAT "/history%u.dat"   // один файл-кільце на рівень
+#define HISTORY_READ_BATCH  16                 // точок за одне читання для /history
+#define HISTORY_POINT_TEXT_MAX 36              // "[time,pa,deci]," у JSON
+
+// ============= ДИСПЛЕЙ =============
+#define SCREEN_WIDTH      240
+#define SCREEN_HEIGHT     240
+#define FRAMEBUFFER_BPP   2     // 4 кольори інтерфейсу в палітрі
+#define DISPLAY_TASK_STACK    4096
+#define DISPLAY_TASK_PRIORITY 1
+#define PANEL_MEMORY_HEIGHT   320   // GRAM ST7789 - 240x320
+#define PANEL_SCROLL_MIRRORED 0     // 1, якщо рядки GRAM ідуть назустріч x
+
+// Анімації перемикання екранів
+#define TRANSITION_SLIDE_MS   320
+#define TRANSITION_FADE_MS    240   // окремо на згасання і на появу
+#define TRANSITION_FRAME_MS   25    // з запасом на тік планувальника
+#define FRAME_BUDGET_MS       33    // довший кадр вважається пропущеним
+
+// Графік тиску за добу на екрані NATURE: колонка на інтервал
+#define GRAPH_COLUMNS         192
+#define GRAPH_HEIGHT          32
+#define GRAPH_COLUMN_SECONDS  (24UL * 3600 / GRAPH_COLUMNS)   // 450 с
+#define GRAPH_SCALE_STEP      10    // межі шкали кратні 1 гПа (у 0.1 гПа)
+#define GRAPH_MIN_SPAN        40    // шкала не вужча за 4 гПа
+#define GRAPH_TREND_COLUMNS   (3UL * 3600 / GRAPH_COLUMN_SECONDS)  // барична тенденція за 3 год
+#define GRAPH_TREND_THRESHOLD 10    // зміна менше 1 гПа - тиск стабільний
+#define GRAPH_SPI_BUDGET      512   // байтів на панель за нову колонку без зміни шкали
 
 // ============= НАЛАШТУВАННЯ WiFi =============
 #define AP_SSID "ESP_Terminal"
 #define AP_PASSWORD "12345678"
 #define WEB_SERVER_PORT 80
+#define NET_TASK_STACK     8192
+#define NET_TASK_PRIORITY  1
+#define WIFI_BOOT_TIMEOUT_MS     10000  // стільки setup() чекає першого з'єднання
+#define WIFI_CONNECT_TIMEOUT_MS  10000  // одна спроба до отримання IP
+#define WIFI_RETRY_MIN_MS        1000   // пауза перед повтором, далі подвоюється
+#define WIFI_RETRY_MAX_MS        60000
+#define WIFI_SWITCH_DELAY_MS     500    // на відключення від попередньої мережі
+#define WIFI_FAST_TIMEOUT_MS     3000   // пряме підключення за збереженим BSSID
+#define WIFI_SCAN_TIMEOUT_MS     8000
+#define WIFI_MAX_NETWORKS        4      // збережені мережі, перша - найважливіша
+#define WIFI_SSID_MAX            32
+#define WIFI_PASSWORD_MAX        64
+#define HTTP_MAX_CONNECTIONS     6      // разом з потоками /events; сокетів lwIP лише 10
+#define HTTP_MAX_ROUTES          16
+#define HTTP_HEAD_MAX            1024   // рядок запиту і заголовки
+#define HTTP_BODY_MAX            512    // більші тіла - лише потоком, інакше 413
+#define HTTP_EXTRA_HEADERS_MAX   256
+#define HTTP_OUT_MAX             3072   // заголовки і тіло відповіді
+#define HTTP_IDLE_TIMEOUT_MS     5000   // keep-alive і повільні клієнти
+#define HTTP_DEFER_TIMEOUT_MS    20000  // відкладена відповідь, далі 504
+#define EVENTS_MAX_CLIENTS       3      // решта з'єднань пулу - для запитів
+#define EVENTS_COALESCE_MS       250    // зміни за цей час ідуть однією подією
+#define EVENTS_HEARTBEAT_MS      15000
+#define EVENTS_RSSI_STEP         5      // дБм; дрібніші коливання не надсилаються
+#define EVENTS_BUFFER_SIZE       512
 
 // ============= НАЛАШТУВАННЯ ПОГОДИ =============
 #define WEATHER_CITY "Kyiv"
 #define WEATHER_UPDATE_INTERVAL 600000  // 10 хвилин
+#define WEATHER_RETRY_INTERVAL  30000   // повтор після невдалого запиту
+#define WEATHER_TASK_STACK      8192
+#define WEATHER_TASK_PRIORITY   1
+#define WEATHER_KEY_MAX         64
+#define WEATHER_DESCRIPTION_MAX 48
+#define WEATHER_FILTER_BYTES    128     // фільтр полів відповіді
+#define WEATHER_DOC_BYTES       384     // лише відфільтровані поля
 
 // ============= NTP НАЛАШТУВАННЯ =============
 #define NTP_SERVER "pool.ntp.org"
-#define GMT_OFFSET_SEC 7200
-#define DAYLIGHT_OFFSET_SEC 0
+#define TZ_STRING "EET-2EEST,M3.5.0/3,M10.5.0/4"  // Київ: перехід на літній і назад
+#define CLOCK_VALID_EPOCH 1700000000  // раніше - годинник ще не синхронізовано
 #define NTP_UPDATE_INTERVAL 3600000
 
 // ============= PREFERENCES =============
 #define PREF_NAMESPACE "wifi_config"
+#define SETTINGS_VERSION 2   // 2 - список будильників замість одного
+#define SETTINGS_FLUSH_DELAY_MS 3000   // зміни в межах цього часу - один запис у NVS
 
 // ============= ТАЙМЕРИ =============
-#define TIME_UPDATE_INTERVAL 1000
 #define BUTTON_LONG_PRESS_TIME 1000
-#define BUTTON_DEBOUNCE_DELAY 50
+#define BUTTON_DEBOUNCE_DELAY 30     // тиша після останнього фронту, мс
+#define BUTTON_DOUBLE_CLICK_TIME 300  // між відпусканнями двох кліків
+#define BUTTON_REPEAT_INTERVAL 700    // повтор після довгого натискання
+#define BUTTON_FEEDBACK_BLINKS 3
+#define BUTTON_FEEDBACK_INTERVAL 100
+#define WEB_POLL_INTERVAL 20        // найдовше очікування select() між обслуговуванням WiFi
+#define SENSOR_SAMPLE_INTERVAL 1000
+#define SECOND_MARGIN_MS 5          // запуск годинника трохи після межі секунди
+
+// ============= ДАТЧИК BMP280 =============
+// Погодна станція в приміщенні: тиск x16, температура x2, IIR x16
+// гасить протяги й дотики; датчик міряє кожні 500 мс, читаємо раз на SENSOR_SAMPLE_INTERVAL
+#define SENSOR_TEMPERATURE_OVERSAMPLING Adafruit_BMP280::SAMPLING_X2
+#define SENSOR_PRESSURE_OVERSAMPLING    Adafruit_BMP280::SAMPLING_X16
+#define SENSOR_IIR_FILTER               Adafruit_BMP280::FILTER_X16
+#define SENSOR_STANDBY                  Adafruit_BMP280::STANDBY_MS_500
+
+// ============= ЗАДАЧІ І ЧЕРГИ =============
+#define SENSOR_TASK_STACK    4096  // запис журналу в LittleFS
+#define SENSOR_TASK_PRIORITY 1
+#define UI_QUEUE_LENGTH      8     // SPSC-черги - степені двійки
+#define NET_QUEUE_LENGTH     4
+#define SENSOR_QUEUE_LENGTH  4
+#define BUTTON_QUEUE_LENGTH  8
+
+// ============= ПЛАНУВАЛЬНИК =============
+#define SCHEDULER_TICK_MS      5
+#define SCHEDULER_WHEEL_SLOTS  128   // степінь двійки; оберт - 640 мс
+#define SCHEDULER_MAX_JOBS     8
+#define SCHEDULER_STATS_WINDOW 10    // секунд на вимір частки сну
 
 // ============= УПРАВЛІННЯ СВІТЛОДІОДАМИ =============
+// Значення зберігаються в NVS - нові режими лише додавати в кінець
 enum LedMode {
   LED_FORCE = 0,
-  LED_OFF = 1
+  LED_OFF = 1,
+  LED_DIM = 2,       // нічник
+  LED_BREATHE = 3,   // повільне дихання
+  LED_MODE_COUNT
 };
 
+#define LED_PWM_FREQ        5000
+#define LED_PWM_BITS        10
+#define LED_DUTY_MAX        ((1 << LED_PWM_BITS) - 1)
+#define LED_DIM_LEVEL       96
+#define LED_INDICATOR_LEVEL 512   // жовтий, поки кнопка натиснута
+#define LED_FADE_MS         200   // перехід між режимами
+#define LED_BREATHE_MS      1500  // вдих або видих
+
 // ============= УПРАВЛІННЯ ЕКРАНАМИ =============
 enum Screen {
   SCREEN_TIME = 0,
@@ -67,8 +187,9 @@ enum Screen {
 };
 
 // ============= СТРУКТУРА ДАНИХ ПОГОДИ =============
+// Без String: копія між задачами - лише memcpy, без спільних алокацій
 struct WeatherData {
-  String description = "No data";
+  char description[WEATHER_DESCRIPTION_MAX] = "No data";
   float temperature = 0.0;
   int humidity = 0;
   int pressure = 0;
@@ -0,0 +1,285 @@
+#include "connection.h"
+
+ConnectionManager::ConnectionManager(Storage* stor)
+  : storage(stor), networkCount(0), leaseValid(false), fastAttempt(false),
+    staticConfig(false), pendingEvents(0), state(LINK_IDLE), lastReason(0),
+    handlerAdded(false), attemptStart(0), retryAt(0), backoffMs(WIFI_RETRY_MIN_MS),
+    offlineSince(0), everConnected(false),
+    attempts(0), disconnects(0), lastReconnectMs(0), maxReconnectMs(0),
+    bootConnectMs(0), fastConnects(0), lastConnectFast(false) {
+}
+
+bool ConnectionManager::begin(bool allowFastPath) {
+  networkCount = storage->loadNetworks(networks, WIFI_MAX_NETWORKS);
+  if (networkCount == 0) return false;
+
+  if (!handlerAdded) {
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+      onWiFiEvent(event, info);
+    });
+    handlerAdded = true;
+  }
+
+  leaseValid = allowFastPath && storage->loadLease(lease) && findNetwork(lease.ssid) >= 0;
+  backoffMs = WIFI_RETRY_MIN_MS;
+
+  // У режимі точки доступу сторінка налаштувань має лишатися доступною
+  WiFi.mode((WiFi.getMode() & WIFI_MODE_AP) ? WIFI_AP_STA : WIFI_STA);
+  WiFi.setAutoReconnect(false);
+
+  uint32_t now = millis();
+  LinkState current = getState();
+  if (current == LINK_CONNECTED || current == LINK_CONNECTING) {
+    // Подію відключення від старої мережі автомат пропустить у паузі
+    if (current == LINK_CONNECTED) {
+      offlineSince = now;
+    }
+    WiFi.disconnect();
+    scheduleRetry(now, WIFI_SWITCH_DELAY_MS);
+    return true;
+  }
+
+  nextAttempt(now);
+  return true;
+}
+
+void ConnectionManager::onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      pendingEvents.fetch_or(LINK_EVENT_GOT_IP);
+      break;
+
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      lastReason = info.wifi_sta_disconnected.reason;
+      pendingEvents.fetch_or(LINK_EVENT_DISCONNECTED);
+      break;
+
+    case ARDUINO_EVENT_WIFI_SCAN_DONE:
+      pendingEvents.fetch_or(LINK_EVENT_SCAN_DONE);
+      break;
+
+    default:
+      break;
+  }
+}
+
+int8_t ConnectionManager::findNetwork(const char* ssid) const {
+  for (uint8_t i = 0; i < networkCount; i++) {
+    if (strcmp(networks[i].ssid, ssid) == 0) return i;
+  }
+  return -1;
+}
+
+void ConnectionManager::nextAttempt(uint32_t now) {
+  if (leaseValid) {
+    startFast(now);
+  } else {
+    startScan(now);
+  }
+}
+
+void ConnectionManager::startFast(uint32_t now) {
+  const WiFiNetwork& network = networks[findNetwork(lease.ssid)];
+
+  // Адреса з минулої оренди DHCP і пряма асоціація з тією ж точкою
+  WiFi.config(IPAddress(lease.ip), IPAddress(lease.gateway),
+              IPAddress(lease.subnet), IPAddress(lease.dns));
+  staticConfig = true;
+
+  attempts++;
+  attemptStart = now;
+  fastAttempt = true;
+  state.store(LINK_CONNECTING);
+  WiFi.begin(network.ssid, network.password, lease.channel, lease.bssid);
+}
+
+void ConnectionManager::startScan(uint32_t now) {
+  useDhcp();
+  WiFi.scanDelete();
+
+  attemptStart = now;
+  fastAttempt = false;
+  state.store(LINK_SCANNING);
+  WiFi.scanNetworks(true);
+}
+
+void ConnectionManager::onScanDone(uint32_t now) {
+  int16_t found = WiFi.scanComplete();
+
+  // Найвищий пріоритет серед видимих, для однакових SSID - найсильніший сигнал
+  int8_t bestNetwork = -1;
+  int16_t bestResult = -1;
+  for (int16_t i = 0; i < found; i++) {
+    int8_t network = findNetwork(WiFi.SSID(i).c_str());
+    if (network < 0) continue;
+    if (bestNetwork < 0 || network < bestNetwork ||
+        (network == bestNetwork && WiFi.RSSI(i) > WiFi.RSSI(bestResult))) {
+      bestNetwork = network;
+      bestResult = i;
+    }
+  }
+
+  if (bestNetwork < 0) {
+    WiFi.scanDelete();
+    onDisconnected(now);
+    return;
+  }
+
+  attempts++;
+  attemptStart = now;
+  state.store(LINK_CONNECTING);
+  WiFi.begin(networks[bestNetwork].ssid, networks[bestNetwork].password,
+             WiFi.channel(bestResult), WiFi.BSSID(bestResult));
+  WiFi.scanDelete();
+}
+
+void ConnectionManager::useDhcp() {
+  if (!staticConfig) return;
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  staticConfig = false;
+}
+
+void ConnectionManager::rememberLease() {
+  WiFiLease current = {};
+  strlcpy(current.ssid, WiFi.SSID().c_str(), sizeof(current.ssid));
+  memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+  current.channel = WiFi.channel();
+  current.ip = (uint32_t)WiFi.localIP();
+  current.gateway = (uint32_t)WiFi.gatewayIP();
+  current.subnet = (uint32_t)WiFi.subnetMask();
+  current.dns = (uint32_t)WiFi.dnsIP(0);
+
+  // NVS пишеться, лише коли змінилась точка чи адреса
+  bool changed = !leaseValid || memcmp(&current, &lease, sizeof(current)) != 0;
+  lease = current;
+  leaseValid = true;
+  if (changed) {
+    storage->saveLease(lease);
+  }
+}
+
+void ConnectionManager::scheduleRetry(uint32_t now, uint32_t delayMs) {
+  retryAt = now + delayMs;
+  state.store(LINK_BACKOFF);
+}
+
+void ConnectionManager::onDisconnected(uint32_t now) {
+  LinkState current = getState();
+
+  // Відключення, яке ми ж і викликали перед паузою
+  if (current == LINK_BACKOFF || current == LINK_IDLE) return;
+
+  if (current == LINK_CONNECTING && fastAttempt) {
+    // Точка змінилась чи недоступна - в цій сесії лише через сканування
+    leaseValid = false;
+    WiFi.disconnect();
+    startScan(now);
+    return;
+  }
+
+  if (current == LINK_CONNECTED) {
+    offlineSince = now;
+    disconnects++;
+    // Після стабільного з'єднання перша спроба - без довгої паузи
+    backoffMs = WIFI_RETRY_MIN_MS;
+  }
+
+  // Випадковий зсув, щоб пристрої після збою роутера не йшли хвилею
+  uint32_t delayMs = backoffMs + esp_random() % (backoffMs / 4 + 1);
+  backoffMs = min((uint32_t)WIFI_RETRY_MAX_MS, backoffMs * 2);
+  scheduleRetry(now, delayMs);
+}
+
+bool ConnectionManager::onGotIp(uint32_t now) {
+  if (getState() == LINK_CONNECTED) return false;
+
+  bool reconnected = false;
+  if (everConnected) {
+    lastReconnectMs = now - offlineSince;
+    if (lastReconnectMs > maxReconnectMs) {
+      maxReconnectMs = lastReconnectMs;
+    }
+    reconnected = true;
+  } else {
+    bootConnectMs = now;
+  }
+
+  lastConnectFast = fastAttempt;
+  if (fastAttempt) {
+    fastConnects++;
+  }
+  rememberLease();
+
+  everConnected = true;
+  backoffMs = WIFI_RETRY_MIN_MS;
+  state.store(LINK_CONNECTED);
+  return reconnected;
+}
+
+bool ConnectionManager::service() {
+  uint32_t now = millis();
+  uint32_t events = pendingEvents.exchange(0);
+  bool reconnected = false;
+
+  if ((events & LINK_EVENT_SCAN_DONE) && getState() == LINK_SCANNING) {
+    onScanDone(now);
+  }
+  if ((events & LINK_EVENT_DISCONNECTED) && getState() != LINK_SCANNING) {
+    onDisconnected(now);
+  }
+  if (events & LINK_EVENT_GOT_IP) {
+    reconnected = onGotIp(now);
+  }
+
+  switch (getState()) {
+    case LINK_CONNECTED:
+      // Обидві події між двома викликами - вирішує фактичний стан
+      if (WiFi.status() != WL_CONNECTED) {
+        onDisconnected(now);
+      }
+      break;
+
+    case LINK_SCANNING:
+      if (now - attemptStart >= WIFI_SCAN_TIMEOUT_MS) {
+        onDisconnected(now);
+      }
+      break;
+
+    case LINK_CONNECTING: {
+      uint32_t timeout = fastAttempt ? WIFI_FAST_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS;
+      if (now - attemptStart >= timeout) {
+        if (!fastAttempt) {
+          WiFi.disconnect();
+        }
+        onDisconnected(now);
+      }
+      break;
+    }
+
+    case LINK_BACKOFF:
+      if ((int32_t)(now - retryAt) >= 0) {
+        nextAttempt(now);
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return reconnected;
+}
+
+const char* ConnectionManager::getStateName() const {
+  switch (getState()) {
+    case LINK_SCANNING:   return "scanning";
+    case LINK_CONNECTING: return "connecting";
+    case LINK_CONNECTED:  return "connected";
+    case LINK_BACKOFF:    return "backoff";
+    default:              return "idle";
+  }
+}
+
+uint32_t ConnectionManager::getOfflineMs() const {
+  if (!everConnected || isConnected()) return 0;
+  return millis() - offlineSince;
+}
\ No newline at end of file
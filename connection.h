@@ -0,0 +1,105 @@
+#ifndef CONNECTION_H
+#define CONNECTION_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <atomic>
+#include "config.h"
+#include "storage.h"
+
+enum LinkState : uint8_t {
+  LINK_IDLE,        // немає мережі для підключення
+  LINK_SCANNING,    // шукаємо збережені мережі в ефірі
+  LINK_CONNECTING,  // WiFi.begin() виконано, чекаємо IP
+  LINK_CONNECTED,
+  LINK_BACKOFF      // спроба не вдалась, пауза перед наступною
+};
+
+// Події WiFi, які обробник з задачі подій Arduino лишає для service()
+enum LinkEvent : uint32_t {
+  LINK_EVENT_GOT_IP       = 1UL << 0,
+  LINK_EVENT_DISCONNECTED = 1UL << 1,
+  LINK_EVENT_SCAN_DONE    = 1UL << 2
+};
+
+// Стан з'єднання зі станцією. Обробник подій WiFi лише ставить
+// прапорці, а переходи й повторні спроби з наростаючою паузою
+// робить service() з задачі "net". Автоперепідключення ядра
+// вимкнене, щоб спробами керував лише цей автомат.
+//
+// Спершу - швидкий шлях: збережені BSSID, канал і адреса останнього
+// з'єднання, без сканування і DHCP. Якщо не вийшло - асинхронне
+// сканування і найпріоритетніша зі збережених мереж, яку видно.
+class ConnectionManager {
+private:
+  Storage* storage;
+  WiFiNetwork networks[WIFI_MAX_NETWORKS];
+  uint8_t networkCount;
+  WiFiLease lease;
+  bool leaseValid;
+  bool fastAttempt;
+  bool staticConfig;
+
+  std::atomic<uint32_t> pendingEvents;
+  std::atomic<uint8_t> state;
+  volatile uint8_t lastReason;
+  bool handlerAdded;
+
+  uint32_t attemptStart;
+  uint32_t retryAt;
+  uint32_t backoffMs;
+  uint32_t offlineSince;
+  bool everConnected;
+
+  uint32_t attempts;
+  uint32_t disconnects;
+  uint32_t lastReconnectMs;
+  uint32_t maxReconnectMs;
+  uint32_t bootConnectMs;
+  uint32_t fastConnects;
+  bool lastConnectFast;
+
+  void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+  int8_t findNetwork(const char* ssid) const;
+  void nextAttempt(uint32_t now);
+  void startFast(uint32_t now);
+  void startScan(uint32_t now);
+  void onScanDone(uint32_t now);
+  void useDhcp();
+  void rememberLease();
+  void scheduleRetry(uint32_t now, uint32_t delayMs);
+  void onDisconnected(uint32_t now);
+  bool onGotIp(uint32_t now);
+
+public:
+  ConnectionManager(Storage* stor);
+
+  // Читає збережені мережі, починає підключення і одразу повертається.
+  // Якщо вже є з'єднання, воно розривається. allowFastPath = false -
+  // одразу сканування, напр. коли користувач додав нову мережу.
+  // false - немає жодної збереженої мережі.
+  bool begin(bool allowFastPath);
+
+  // Повертає true, коли з'єднання відновилось після обриву
+  bool service();
+
+  bool isConnected() const { return state.load() == LINK_CONNECTED; }
+  LinkState getState() const { return (LinkState)state.load(); }
+  const char* getStateName() const;
+
+  uint32_t getAttempts() const { return attempts; }
+  uint32_t getDisconnects() const { return disconnects; }
+  uint8_t getLastReason() const { return lastReason; }
+  // Від обриву до нового IP
+  uint32_t getLastReconnectMs() const { return lastReconnectMs; }
+  uint32_t getMaxReconnectMs() const { return maxReconnectMs; }
+  // Скільки триває поточний обрив; 0 - з'єднання є
+  uint32_t getOfflineMs() const;
+  // Від старту прошивки до першого IP; 0 - ще не було
+  uint32_t getBootConnectMs() const { return bootConnectMs; }
+  uint32_t getFastConnects() const { return fastConnects; }
+  bool wasLastConnectFast() const { return lastConnectFast; }
+  uint8_t getNetworkCount() const { return networkCount; }
+};
+
+#endif // CONNECTION_H
\ No newline at end of file
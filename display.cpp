@@ -41,46 +41,114 @@ LGFX::LGFX(void) {
   setPanel(&_panel);
 }
 
-DisplayManager::DisplayManager(LGFX* display, LGFX_Sprite* spr, Adafruit_BMP280* sensor, Screen* screen)
-  : tft(display), sprite(spr), bmp(sensor), currentScreen(screen),
-    lastWeekday(""), lastWeather(""),
-    lastTemperature(0), lastPressure(-1.0) {
+// Розмітка екрана
+#define HEADER_WIDGETS 3
+static const Rect FULL_SCREEN = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+
+// Базові кольори палітри (RGB888) за PaletteIndex; з них же рахується згасання
+static const uint32_t FRAMEBUFFER_PALETTE[] = {
+  0x000000,  // PAL_BLACK
+  0x007D00,  // PAL_DARKGREEN
+  0x00FF00,  // PAL_GREEN
+  0xFFFF00   // PAL_YELLOW
+};
+#define FRAMEBUFFER_PALETTE_SIZE (sizeof(FRAMEBUFFER_PALETTE) / sizeof(FRAMEBUFFER_PALETTE[0]))
+
+// Верхні межі кошиків гістограми, мс; останній кошик - все довше
+static const uint32_t FRAME_HISTOGRAM_LIMITS[FRAME_HISTOGRAM_BUCKETS - 1] = {16, 33, 50, 100};
+
+DisplayManager::DisplayManager(LGFX* display, LGFX_Sprite* spr, LGFX_Sprite* backSpr,
+                               Screen* screen)
+  : tft(display), sprite(spr), backSprite(backSpr), currentScreen(screen),
+    shownScreen(SCREEN_COUNT), compositor(display, spr, backSpr, PAL_BLACK),
+    framebufferBytes(0), framebufferHeapUsed(0),
+    tabTime(0, 0, 48, 16, "TIME", PAL_DARKGREEN, 2),
+    tabNature(86, 0, 72, 16, "NATURE", PAL_DARKGREEN, 2),
+    tabSettings(196, 0, 36, 16, "SET", PAL_DARKGREEN, 2),
+    weekdayValue(0, 90, 170, 24, PAL_GREEN, 3),
+    dateValue(0, 130, 180, 24, PAL_GREEN, 3),
+    clockValue(0, 180, PAL_GREEN, 5),
+    descriptionValue(0, 90, 240, 16, PAL_GREEN, 2),
+    temperatureValue(0, 120, 160, 16, PAL_GREEN, 2),
+    pressureValue(0, 150, 160, 16, PAL_GREEN, 2),
+    roomTemperatureValue(164, 150, 76, 16, PAL_GREEN, 2),
+    humidityValue(0, 180, 100, 16, PAL_GREEN, 2),
+    humidityBar(104, 182, 130, 12, 100, PAL_DARKGREEN),
+    pressureGraph(0, 204, GRAPH_HEIGHT, PAL_GREEN, PAL_DARKGREEN),
+    pressureTrend(208, 204, 24, GRAPH_HEIGHT, PAL_GREEN),
+    ipLabel(0, 50, 120, 16, "SERVER IP:", PAL_GREEN, 2),
+    ipValue(0, 80, 240, 16, PAL_GREEN, 2),
+    alarmLabel(0, 140, 72, 16, "ALARM:", PAL_GREEN, 2),
+    alarmTimeValue(0, 170, 240, 16, PAL_GREEN, 2),
+    alarmStatusValue(0, 200, 240, 16, PAL_GREEN, 2),
+    transition(TRANSITION_NONE), fadingIn(false), slideOffset(0),
+    transitionStart(0), lastEffectFrame(0), effectFrames(0),
+    graphBucket(0), graphSum(0), graphCount(0), lastGraphBucket(0),
+    droppedFrames(0), transitionCount(0),
+    inputEdgeUs(0), lastInputLatencyUs(0), maxInputLatencyUs(0) {
+  memset(frameHistogram, 0, sizeof(frameHistogram));
 }
 
 void DisplayManager::init() {
   tft->init();
   tft->setRotation(1);
-  sprite->createSprite(240, 60);
-  sprite->setTextSize(5);
-  sprite->setTextColor(TFT_GREEN);
+
+  // Два повноекранні буфери 240x240 при 2 bpp - по 14.4 КБ,
+  // разом як колишня одна смуга 240x60 при 16 bpp (28.8 КБ)
+  uint32_t heapBefore = ESP.getFreeHeap();
+  setupFramebuffer(sprite);
+  setupFramebuffer(backSprite);
+  framebufferBytes = sprite->bufferLength() + backSprite->bufferLength();
+  framebufferHeapUsed = heapBefore - ESP.getFreeHeap();
+
+  clockValue.begin();
+  compositor.begin(FRAMEBUFFER_PALETTE, FRAMEBUFFER_PALETTE_SIZE);
+
+  compositor.add(&tabTime);
+  compositor.add(&tabNature);
+  compositor.add(&tabSettings);
+}
+
+void DisplayManager::setupFramebuffer(LGFX_Sprite* buffer) {
+  buffer->setColorDepth(FRAMEBUFFER_BPP);
+  buffer->createSprite(SCREEN_WIDTH, SCREEN_HEIGHT);
+  buffer->createPalette();
+  for (uint8_t i = 0; i < FRAMEBUFFER_PALETTE_SIZE; i++) {
+    uint32_t rgb = FRAMEBUFFER_PALETTE[i];
+    buffer->setPaletteColor(i, (uint8_t)(rgb >> 16), (uint8_t)(rgb >> 8), (uint8_t)rgb);
+  }
+  buffer->fillSprite(PAL_BLACK);
 }
 
 void DisplayManager::intro(const String& savedSSID) {
   tft->fillScreen(TFT_BLACK);
-  sprite->fillSprite(TFT_BLACK);
-  sprite->setTextColor(TFT_GREEN);
+  sprite->fillSprite(PAL_BLACK);
+  sprite->setTextColor(PAL_GREEN);
   sprite->setTextSize(2);
 
   if (savedSSID.length() > 0) {
     int attempts = 0;
     while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-      sprite->fillScreen(TFT_BLACK);
-      sprite->setCursor(0, 0);
+      sprite->fillRect(0, 80, SCREEN_WIDTH, 40, PAL_BLACK);
+      sprite->setCursor(0, 80);
       sprite->print("Connecting");
       for (int i = 0; i < (attempts % 4); i++) {
         sprite->print(".");
       }
-      sprite->setCursor(0, 20);
+      sprite->setCursor(0, 100);
       sprite->print(savedSSID);
-      sprite->pushSprite(0, 80);
+
+      // Відправляємо лише смугу з текстом
+      tft->setClipRect(0, 80, SCREEN_WIDTH, 40);
+      sprite->pushSprite(0, 0);
+      tft->clearClipRect();
      
       delay(500);
       attempts++;
     }
   }
 
-  sprite->setTextSize(5);
-  sprite->setTextColor(TFT_GREEN);
+  sprite->fillSprite(PAL_BLACK);
 }
 
 void DisplayManager::displayApMode() {
@@ -109,141 +177,362 @@ void DisplayManager::displayApMode() {
   tft->print(WiFi.softAPIP().toString());
 }
 
-void DisplayManager::clearScreenArea() {
-  tft->fillRect(0, 20, 240, 220, TFT_BLACK);
+void DisplayManager::showScreen(Transition effect) {
+  // Перший показ після intro/AP - очищаємо весь екран без анімації
+  if (shownScreen == SCREEN_COUNT) {
+    compositor.invalidate(FULL_SCREEN);
+    effect = TRANSITION_NONE;
+  }
+  shownScreen = *currentScreen;
+
+  // Нове перемикання посеред анімації - попередню завершуємо одразу
+  if (transition != TRANSITION_NONE) {
+    abortTransition();
+  }
+
+  transition = effect;
+  fadingIn = false;
+  slideOffset = 0;
+  transitionStart = millis();
+  // Перший кадр анімації - з найближчим tick(), без паузи TRANSITION_FRAME_MS
+  lastEffectFrame = transitionStart - TRANSITION_FRAME_MS;
+  effectFrames = 0;
+
+  switch (effect) {
+    case TRANSITION_FADE:
+      // Старі віджети лишаються на екрані, доки він не згасне
+      fadeRegion.clear();
+      compositor.collectWidgetBounds(fadeRegion);
+      transitionCount++;
+      break;
+
+    case TRANSITION_SLIDE_LEFT:
+    case TRANSITION_SLIDE_RIGHT:
+      // Новий екран цілком малюється в буфер першим же кадром
+      buildScreen();
+      compositor.invalidate(FULL_SCREEN);
+      transitionCount++;
+      break;
+
+    default:
+      buildScreen();
+      break;
+  }
 }
 
-void DisplayManager::resetCache() {
-  lastWeekday = "";
-  lastWeather = "";
-  lastTemperature = 0;
-  lastPressure = -1.0;
+void DisplayManager::buildScreen() {
+  compositor.clearWidgets(HEADER_WIDGETS);
+
+  uint16_t normalColor = PAL_DARKGREEN;
+  uint16_t highlightColor = PAL_GREEN;
+  tabTime.setColor(*currentScreen == SCREEN_TIME ? highlightColor : normalColor);
+  tabNature.setColor(*currentScreen == SCREEN_NATURE ? highlightColor : normalColor);
+  tabSettings.setColor(*currentScreen == SCREEN_SETTINGS ? highlightColor : normalColor);
+
+  switch (*currentScreen) {
+    case SCREEN_TIME:
+      compositor.add(&weekdayValue);
+      compositor.add(&dateValue);
+      compositor.add(&clockValue);
+      break;
+
+    case SCREEN_NATURE:
+      compositor.add(&descriptionValue);
+      compositor.add(&temperatureValue);
+      compositor.add(&pressureValue);
+      compositor.add(&roomTemperatureValue);
+      compositor.add(&humidityValue);
+      compositor.add(&humidityBar);
+      compositor.add(&pressureGraph);
+      compositor.add(&pressureTrend);
+      break;
+
+    case SCREEN_SETTINGS:
+      compositor.add(&ipLabel);
+      compositor.add(&ipValue);
+      compositor.add(&alarmLabel);
+      compositor.add(&alarmTimeValue);
+      compositor.add(&alarmStatusValue);
+      break;
+
+    default:
+      break;
+  }
 }
 
-void DisplayManager::displayHeader() {
-  tft->fillScreen(TFT_BLACK);
- 
-  tft->setTextSize(2);
-  uint16_t normalColor = TFT_DARKGREEN;
-  uint16_t highlightColor = TFT_GREEN;
- 
-  tft->setTextColor(*currentScreen == SCREEN_TIME ? highlightColor : normalColor);
-  tft->setCursor(0, 0);
-  tft->print("TIME");
+bool DisplayManager::submitFrame() {
+  if (transition != TRANSITION_NONE) return false;
 
-  tft->setTextColor(*currentScreen == SCREEN_NATURE ? highlightColor : normalColor);
-  tft->setCursor(86, 0);
-  tft->print("NATURE");
+  bool submitted = compositor.submit();
+  if (submitted) {
+    recordInputLatency();
+  }
+  return submitted;
+}
 
-  tft->setTextColor(*currentScreen == SCREEN_SETTINGS ? highlightColor : normalColor);
-  tft->setCursor(196, 0);
-  tft->print("SET");
+void DisplayManager::abortTransition() {
+  transition = TRANSITION_NONE;
 
-  tft->setTextColor(TFT_GREEN);
+  // Повертаємо прокрутку і яскравість і виводимо весь екран з буфера
+  DirtyRegion full;
+  full.add(FULL_SCREEN);
+  compositor.invalidate(FULL_SCREEN);
+  compositor.submitEffect(full, 0, FRAME_LEVEL_FULL);
 }
 
-const char* getWeekDayName(time_t epoch) {
-  struct tm* timeinfo = gmtime(&epoch);
-  int wday = timeinfo->tm_wday;
-  const char* days[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-  return days[wday];
+void DisplayManager::tick() {
+  if (transition == TRANSITION_NONE) return;
+
+  uint32_t now = millis();
+  if (!compositor.isFrameComplete() || now - lastEffectFrame < TRANSITION_FRAME_MS) {
+    return;
+  }
+
+  // Час між кадрами анімації з урахуванням усього, що робив loop()
+  if (effectFrames > 0) {
+    recordFrameTime(now - lastEffectFrame);
+  }
+  lastEffectFrame = now;
+  effectFrames++;
+
+  uint32_t elapsed = now - transitionStart;
+  uint32_t submittedBefore = compositor.getFramesSubmitted();
+  if (transition == TRANSITION_FADE) {
+    tickFade(elapsed);
+  } else {
+    tickSlide(elapsed);
+  }
+  if (compositor.getFramesSubmitted() != submittedBefore) {
+    recordInputLatency();
+  }
+
+  if (transition == TRANSITION_NONE) {
+    // Зміни віджетів, що накопичились за час анімації
+    compositor.submit();
+  }
 }
 
-void DisplayManager::displayWeekInfo(NTPClient& timeClient) {
-  time_t epoch = timeClient.getEpochTime();
-  const char* weekday = getWeekDayName(epoch);
-  String currentWeekday = String(weekday);
+void DisplayManager::tickSlide(uint32_t elapsed) {
+  // Позиція залежить від часу, тож пропущений кадр не сповільнює анімацію
+  int16_t target = elapsed >= TRANSITION_SLIDE_MS
+                   ? SCREEN_WIDTH
+                   : (int16_t)(elapsed * SCREEN_WIDTH / TRANSITION_SLIDE_MS);
+  if (target <= slideOffset) return;
+
+  // Смуга нового екрана пишеться на своє незсунуте місце в GRAM,
+  // а прокрутка виводить її біля краю, з якого заїжджає екран.
+  // Після повного оберту зсув знову нульовий, а GRAM - новий екран.
+  Rect strip;
+  int16_t scroll;
+  if (transition == TRANSITION_SLIDE_LEFT) {
+    strip = {slideOffset, 0, (int16_t)(target - slideOffset), SCREEN_HEIGHT};
+    scroll = target;
+  } else {
+    strip = {(int16_t)(SCREEN_WIDTH - target), 0, (int16_t)(target - slideOffset), SCREEN_HEIGHT};
+    scroll = SCREEN_WIDTH - target;
+  }
+
+  DirtyRegion push;
+  push.add(strip);
+  compositor.submitEffect(push, scroll % SCREEN_WIDTH, FRAME_LEVEL_FULL);
+
+  slideOffset = target;
+  if (slideOffset >= SCREEN_WIDTH) {
+    transition = TRANSITION_NONE;
+  }
+}
 
-  if (currentWeekday == lastWeekday) {
+void DisplayManager::tickFade(uint32_t elapsed) {
+  uint8_t level;
+
+  if (!fadingIn) {
+    level = elapsed >= TRANSITION_FADE_MS
+            ? 0
+            : (uint8_t)(FRAME_LEVEL_FULL - elapsed * FRAME_LEVEL_FULL / TRANSITION_FADE_MS);
+    compositor.submitEffect(fadeRegion, FRAME_SCROLL_KEEP, level);
+
+    if (level == 0) {
+      // Екран чорний - віджети можна поміняти непомітно
+      buildScreen();
+      fadeRegion.clear();
+      compositor.collectWidgetBounds(fadeRegion);
+      fadingIn = true;
+      transitionStart = millis();
+    }
     return;
   }
 
-  lastWeekday = currentWeekday;
+  level = elapsed >= TRANSITION_FADE_MS
+          ? FRAME_LEVEL_FULL
+          : (uint8_t)(elapsed * FRAME_LEVEL_FULL / TRANSITION_FADE_MS);
+  compositor.submitEffect(fadeRegion, FRAME_SCROLL_KEEP, level);
 
-  struct tm *timeinfo = gmtime(&epoch);
-  char dateStr[20];
-  sprintf(dateStr, "%02d.%02d.%04d", timeinfo->tm_mday, timeinfo->tm_mon + 1, timeinfo->tm_year + 1900);
+  if (level == FRAME_LEVEL_FULL) {
+    transition = TRANSITION_NONE;
+  }
+}
 
-  tft->fillRect(0, 90, 170, 90, TFT_BLACK);
-  tft->setTextSize(3);
-  tft->setCursor(0, 90);
-  tft->print(weekday);
+void DisplayManager::recordInputLatency() {
+  if (inputEdgeUs == 0) return;
 
-  tft->setCursor(0, 130);
-  tft->print(dateStr);
+  lastInputLatencyUs = (uint32_t)(esp_timer_get_time() - inputEdgeUs);
+  if (lastInputLatencyUs > maxInputLatencyUs) {
+    maxInputLatencyUs = lastInputLatencyUs;
+  }
+  inputEdgeUs = 0;
 }
 
-void DisplayManager::displayWeatherInfo(const WeatherManager& weather) {
-  tft->setTextSize(2);
- 
-  if (weather.hasData()) {
-    if (lastWeather != weather.getDescription()) {
-      tft->fillRect(0, 90, 200, 30, TFT_BLACK);
-      tft->setCursor(0, 90);
-      lastWeather = weather.getDescription();
-      tft->print(weather.getDescription());
-    }
-    if (lastTemperature != weather.getTemperature()) {
-      tft->fillRect(0, 120, 130, 30, TFT_BLACK);
-      tft->setCursor(0, 120);
-      lastTemperature = weather.getTemperature();
-      tft->printf("Temp: %.1fC", weather.getTemperature());
-    }
+void DisplayManager::recordFrameTime(uint32_t ms) {
+  uint8_t bucket = 0;
+  while (bucket < FRAME_HISTOGRAM_BUCKETS - 1 && ms > FRAME_HISTOGRAM_LIMITS[bucket]) {
+    bucket++;
   }
+  frameHistogram[bucket]++;
 
-  float mmHg = bmp->readPressure() * 0.0075006;
-  if (abs(mmHg - lastPressure) >= 0.1) {
-    tft->fillRect(0, 150, 130, 30, TFT_BLACK);
-    tft->setCursor(0, 150);
-    lastPressure = mmHg;
-    tft->printf("Prss: %.1f", mmHg);
+  if (ms > FRAME_BUDGET_MS) {
+    droppedFrames++;
   }
 }
 
-void DisplayManager::displayTime(NTPClient& timeClient) {
-  sprite->fillSprite(TFT_BLACK);
-  sprite->setCursor(0, 0);
+const char* getWeekDayName(int wday) {
+  const char* days[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+  return days[wday];
+}
 
-  String formattedTime = timeClient.getFormattedTime();
-  sprite->print(formattedTime);
+void DisplayManager::displayWeekInfo(const struct tm& local) {
+  weekdayValue.setText(getWeekDayName(local.tm_wday));
+  dateValue.setFormatted("%02d.%02d.%04d", local.tm_mday, local.tm_mon + 1, local.tm_year + 1900);
+}
 
-  sprite->pushSprite(0, 180);
+void DisplayManager::displayWeatherInfo(const WeatherManager& weather, float pressurePa, float temperature) {
+  WeatherData data;
+  if (weather.getSnapshot(data)) {
+    descriptionValue.setText(data.description);
+    temperatureValue.setFormatted("Temp: %.1fC", data.temperature);
+    humidityValue.setFormatted("Hum: %d%%", data.humidity);
+    humidityBar.setValue(data.humidity);
+  } else {
+    descriptionValue.setText("Waiting for data");
+  }
+
+  // Значення з точністю 0.1 - віджет перемальовується лише при зміні
+  if (isnan(pressurePa)) {
+    pressureValue.setText("Prss: --");
+  } else {
+    pressureValue.setFormatted("Prss: %.1f", pressurePa * 0.0075006);
+  }
+  if (isnan(temperature)) {
+    roomTemperatureValue.setText("--");
+  } else {
+    roomTemperatureValue.setFormatted("%.1fC", temperature);
+  }
 }
 
-void DisplayManager::displaySetScreen(int alarmHour, int alarmMinute, bool alarmEnabled, bool alarmTriggered) {
-  tft->setTextSize(2);
-  tft->setTextColor(TFT_GREEN);
+void DisplayManager::accumulatePressure(uint32_t bucket, int32_t pressurePa) {
+  if (graphCount > 0 && bucket != graphBucket) {
+    if (bucket > graphBucket) {
+      // Па в 0.1 гПа з округленням
+      pushGraphColumn(graphBucket, (uint16_t)((graphSum / graphCount + 5) / 10));
+    }
+    graphCount = 0;
+  }
+  if (graphCount == 0) {
+    graphBucket = bucket;
+    graphSum = 0;
+  }
+  graphSum += pressurePa;
+  graphCount++;
+}
 
-  tft->setCursor(0, 50);
-  tft->print("SERVER IP:");
-  tft->setCursor(0, 80);
-  tft->print(WiFi.localIP().toString());
+void DisplayManager::pushGraphColumn(uint32_t bucket, uint16_t value) {
+  if (lastGraphBucket != 0) {
+    if (bucket <= lastGraphBucket) return;
 
-  tft->setCursor(0, 140);
-  tft->print("ALARM:");
-  tft->setCursor(0, 170);
-  tft->printf("Time: %02d:%02d", alarmHour, alarmMinute);
-  tft->setCursor(0, 200);
-  tft->print("Status: ");
-  if (!alarmEnabled) {
-    tft->print("DISABLED");
-  } else if (alarmTriggered) {
-    tft->print("Triggered");
+    // Інтервали без вибірок лишаються порожніми колонками
+    uint32_t missing = bucket - lastGraphBucket - 1;
+    if (missing > GRAPH_COLUMNS) missing = GRAPH_COLUMNS;
+    while (missing-- > 0) {
+      pressureGraph.push(0);
+    }
+  }
+  pressureGraph.push(value);
+  lastGraphBucket = bucket;
+
+  uint16_t latest = pressureGraph.getValue(0);
+  uint16_t earlier = pressureGraph.getValue(GRAPH_TREND_COLUMNS);
+  if (latest == 0 || earlier == 0) {
+    pressureTrend.setTrend(TREND_UNKNOWN);
+  } else if (latest >= earlier + GRAPH_TREND_THRESHOLD) {
+    pressureTrend.setTrend(TREND_RISING);
+  } else if (earlier >= latest + GRAPH_TREND_THRESHOLD) {
+    pressureTrend.setTrend(TREND_FALLING);
   } else {
-    tft->print("Armed");
+    pressureTrend.setTrend(TREND_STEADY);
   }
 }
 
+void DisplayManager::addPressureSample(time_t now, float pressurePa) {
+  if (now < CLOCK_VALID_EPOCH || isnan(pressurePa)) return;
+  accumulatePressure(now / GRAPH_COLUMN_SECONDS, (int32_t)(pressurePa + 0.5f));
+}
+
+bool DisplayManager::loadPressureHistory(HistoryStore* log) {
+  time_t now = time(NULL);
+  if (now < CLOCK_VALID_EPOCH || !log->isReady()) return false;
+
+  // Хвилинні вибірки усереднюються в колонки так само, як живі;
+  // поточну колонку далі продовжить addPressureSample()
+  uint32_t current = now / GRAPH_COLUMN_SECONDS;
+  uint32_t from = (current - GRAPH_COLUMNS + 1) * GRAPH_COLUMN_SECONDS;
+  uint32_t to = current * GRAPH_COLUMN_SECONDS - 1;
+
+  HistoryCursor cursor;
+  HistoryPoint points[HISTORY_READ_BATCH];
+  log->open(cursor, from, to, 0);
+  size_t count;
+  while ((count = log->read(cursor, points, HISTORY_READ_BATCH)) > 0) {
+    for (size_t i = 0; i < count; i++) {
+      accumulatePressure(points[i].time / GRAPH_COLUMN_SECONDS, points[i].pressurePa);
+    }
+  }
+  // Остання колонка журналу закривається тут, а не з першою живою вибіркою
+  if (graphCount > 0) {
+    pushGraphColumn(graphBucket, (uint16_t)((graphSum / graphCount + 5) / 10));
+    graphCount = 0;
+  }
+  return true;
+}
+
 void DisplayManager::updateTimeScreen(NTPClient& timeClient) {
-  displayWeekInfo(timeClient);
-  displayTime(timeClient);
+  // NTPClient дає UTC; місцевий час і перехід на літній - за TZ_STRING
+  time_t epoch = timeClient.getEpochTime();
+  struct tm local;
+  localtime_r(&epoch, &local);
+
+  char clock[9];
+  strftime(clock, sizeof(clock), "%H:%M:%S", &local);
+
+  displayWeekInfo(local);
+  clockValue.setTime(clock);
+  submitFrame();
 }
 
-void DisplayManager::updateNatureScreen(const WeatherManager& weather) {
-  displayWeatherInfo(weather);
+void DisplayManager::updateNatureScreen(const WeatherManager& weather, float pressurePa, float temperature) {
+  displayWeatherInfo(weather, pressurePa, temperature);
+  submitFrame();
 }
 
 void DisplayManager::updateSettingsScreen(int alarmHour, int alarmMinute, bool alarmEnabled, bool alarmTriggered) {
-  clearScreenArea();
-  displaySetScreen(alarmHour, alarmMinute, alarmEnabled, alarmTriggered);
+  ipValue.setText(WiFi.localIP().toString().c_str());
+  alarmTimeValue.setFormatted("Time: %02d:%02d", alarmHour, alarmMinute);
+
+  if (!alarmEnabled) {
+    alarmStatusValue.setText("Status: DISABLED");
+  } else if (alarmTriggered) {
+    alarmStatusValue.setText("Status: Triggered");
+  } else {
+    alarmStatusValue.setText("Status: Armed");
+  }
+
+  submitFrame();
 }
\ No newline at end of file
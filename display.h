@@ -2,11 +2,13 @@
 #define DISPLAY_H
 
 #include <LovyanGFX.hpp>
-#include <Adafruit_BMP280.h>
 #include <NTPClient.h>
 #include <WiFi.h>
+#include <esp_timer.h>
 #include "config.h"
 #include "weather.h"
+#include "widgets.h"
+#include "history.h"
 
 class LGFX : public lgfx::LGFX_Device {
   lgfx::Panel_ST7789 _panel;
@@ -16,24 +18,104 @@ public:
   LGFX(void);
 };
 
+// Колишня смуга годинника 240x60 при 16 bpp - для порівняння пам'яті
+#define LEGACY_SPRITE_BYTES (240 * 60 * 2)
+
+// Індекси палітри кадрового буфера; у палітрових спрайтах
+// колір малювання - це індекс, RGB565 підставляється при відправці
+enum PaletteIndex {
+  PAL_BLACK = 0,
+  PAL_DARKGREEN = 1,
+  PAL_GREEN = 2,
+  PAL_YELLOW = 3
+};
+
+enum Transition {
+  TRANSITION_NONE,
+  TRANSITION_SLIDE_LEFT,   // новий екран заїжджає справа
+  TRANSITION_SLIDE_RIGHT,  // новий екран заїжджає зліва
+  TRANSITION_FADE
+};
+
+// Кошики гістограми часу кадру анімації: до 16, 33, 50, 100 мс і довше
+#define FRAME_HISTOGRAM_BUCKETS 5
+
 class DisplayManager {
 private:
   LGFX* tft;
   LGFX_Sprite* sprite;
-  Adafruit_BMP280* bmp;
+  LGFX_Sprite* backSprite;
   Screen* currentScreen;
+  Screen shownScreen;
+  Compositor compositor;
+  uint32_t framebufferBytes;
+  uint32_t framebufferHeapUsed;
+
+  // Заголовок - спільний для всіх екранів
+  LabelWidget tabTime;
+  LabelWidget tabNature;
+  LabelWidget tabSettings;
+
+  // TIME
+  ValueWidget weekdayValue;
+  ValueWidget dateValue;
+  ClockWidget clockValue;
 
-  // Кеш даних для оптимізації
-  String lastWeekday;
-  String lastWeather;
-  float lastTemperature;
-  float lastPressure;
+  // NATURE
+  ValueWidget descriptionValue;
+  ValueWidget temperatureValue;
+  ValueWidget pressureValue;
+  ValueWidget roomTemperatureValue;  // з BMP280, поруч із тиском
+  ValueWidget humidityValue;
+  BarWidget humidityBar;
+  GraphWidget pressureGraph;   // тиск за добу, 0.1 гПа на колонку
+  TrendWidget pressureTrend;
+
+  // Середнє вибірок за поточну колонку графіка
+  uint32_t graphBucket;
+  uint32_t graphSum;           // Па
+  uint16_t graphCount;
+  uint32_t lastGraphBucket;    // остання записана колонка, 0 - ще жодної
+
+  // SET
+  LabelWidget ipLabel;
+  ValueWidget ipValue;
+  LabelWidget alarmLabel;
+  ValueWidget alarmTimeValue;
+  ValueWidget alarmStatusValue;
+
+  // Анімація перемикання екранів
+  Transition transition;
+  bool fadingIn;
+  int16_t slideOffset;
+  uint32_t transitionStart;
+  uint32_t lastEffectFrame;
+  uint32_t effectFrames;
+  DirtyRegion fadeRegion;
+  uint32_t frameHistogram[FRAME_HISTOGRAM_BUCKETS];
+  uint32_t droppedFrames;
+  uint32_t transitionCount;
+
+  // Від фронту кнопки до першого кадру нового екрана
+  int64_t inputEdgeUs;
+  uint32_t lastInputLatencyUs;
+  uint32_t maxInputLatencyUs;
  
-  void displayWeekInfo(NTPClient& timeClient);
-  void displayWeatherInfo(const WeatherManager& weather);
+  void setupFramebuffer(LGFX_Sprite* buffer);
+  void buildScreen();
+  void abortTransition();
+  void recordFrameTime(uint32_t ms);
+  void recordInputLatency();
+  void tickSlide(uint32_t elapsed);
+  void tickFade(uint32_t elapsed);
+  void displayWeekInfo(const struct tm& local);
+  void displayWeatherInfo(const WeatherManager& weather, float pressurePa, float temperature);
+  void accumulatePressure(uint32_t bucket, int32_t pressurePa);
+  void pushGraphColumn(uint32_t bucket, uint16_t value);
  
 public:
-  DisplayManager(LGFX* display, LGFX_Sprite* spr, Adafruit_BMP280* sensor, Screen* screen);
+  DisplayManager(LGFX* display, LGFX_Sprite* spr, LGFX_Sprite* backSpr,
+                 Screen* screen);
  
   void init();
   void intro(const String& savedSSID);
@@ -41,15 +123,46 @@ public:
  
   Screen getCurrentScreen() const { return *currentScreen; }
  
-  void displayHeader();
-  void displaySetScreen(int alarmHour, int alarmMinute, bool alarmEnabled, bool alarmTriggered);
-  void displayTime(NTPClient& timeClient);
+  // Перебудовує набір віджетів під *currentScreen; з анімацією
+  // екран змінюється поступово з викликів tick()
+  void showScreen(Transition effect = TRANSITION_NONE);
+  // Крок анімації з loop(): кадр відправляється, лише коли попередній
+  // уже на панелі і минув TRANSITION_FRAME_MS, тож loop() не чекає
+  void tick();
+  // Час фронту кнопки, що спричинив перемикання (esp_timer_get_time());
+  // затримку буде виміряно на першому кадрі нового екрана
+  void markInput(int64_t edgeUs) { inputEdgeUs = edgeUs; }
+  bool isTransitionActive() const { return transition != TRANSITION_NONE; }
   void updateTimeScreen(NTPClient& timeClient);
-  void updateNatureScreen(const WeatherManager& weather);
+  // pressurePa, temperature - відфільтрована вибірка задачі датчика; NAN - ще немає
+  void updateNatureScreen(const WeatherManager& weather, float pressurePa, float temperature);
   void updateSettingsScreen(int alarmHour, int alarmMinute, bool alarmEnabled, bool alarmTriggered);
- 
-  void clearScreenArea();
-  void resetCache();  // Скидання кешу при зміні екрану
+  // Вибірка для графіка тиску: колонка закривається першою вибіркою
+  // наступного інтервалу і дає перемалювати лише себе
+  void addPressureSample(time_t now, float pressurePa);
+  // Заповнює графік останньою добою журналу. false - годинник ще не
+  // синхронізовано або журнал не готовий, виклик треба повторити
+  bool loadPressureHistory(HistoryStore* log);
+
+  // Кадр відправлено - ще не означає, що він уже на панелі.
+  // Під час анімації кадри відправляє tick(), зміни чекають її кінця.
+  bool submitFrame();
+  bool isFrameComplete() const { return compositor.isFrameComplete(); }
+  bool waitFrameComplete(uint32_t timeoutMs) { return compositor.waitFrameComplete(pdMS_TO_TICKS(timeoutMs)); }
+
+  uint32_t getLastFrameBytes() const { return compositor.getLastFrameBytes(); }
+  uint32_t getLastRenderMicros() const { return compositor.getLastRenderMicros(); }
+  uint32_t getLastTransferMicros() const { return compositor.getLastTransferMicros(); }
+  uint32_t getTotalBytes() const { return compositor.getTotalBytes(); }
+  uint32_t getFramesSubmitted() const { return compositor.getFramesSubmitted(); }
+  uint32_t getFramesCompleted() const { return compositor.getFramesCompleted(); }
+  uint32_t getFramebufferBytes() const { return framebufferBytes; }
+  uint32_t getFramebufferHeapUsed() const { return framebufferHeapUsed; }
+  uint32_t getFrameHistogram(uint8_t bucket) const { return frameHistogram[bucket]; }
+  uint32_t getDroppedFrames() const { return droppedFrames; }
+  uint32_t getTransitionCount() const { return transitionCount; }
+  uint32_t getLastInputLatencyUs() const { return lastInputLatencyUs; }
+  uint32_t getMaxInputLatencyUs() const { return maxInputLatencyUs; }
 };
 
 #endif // DISPLAY_H
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "events.h"
+
+static const char EVENTS_RETRY[] = "retry: 3000\n\n";
+static const char EVENTS_HEARTBEAT[] = ": ping\n\n";
+
+uint8_t diffEventState(const EventState& a, const EventState& b) {
+  uint8_t changed = 0;
+
+  if (a.screen != b.screen) changed |= EVENT_GROUP_SCREEN;
+  if (a.alarmHour != b.alarmHour || a.alarmMinute != b.alarmMinute ||
+      a.alarmEnabled != b.alarmEnabled || a.alarmTriggered != b.alarmTriggered ||
+      a.alarmRinging != b.alarmRinging) {
+    changed |= EVENT_GROUP_ALARM;
+  }
+  if (a.weatherStamp != b.weatherStamp) changed |= EVENT_GROUP_WEATHER;
+  if (a.pressureDeciHpa != b.pressureDeciHpa || a.temperatureDeci != b.temperatureDeci) {
+    changed |= EVENT_GROUP_SENSOR;
+  }
+  if (a.linkState != b.linkState || a.rssiBucket != b.rssiBucket) {
+    changed |= EVENT_GROUP_WIFI;
+  }
+
+  return changed;
+}
+
+EventStream::EventStream(HttpServer* http)
+  : server(http), lastWrite(0), eventsSent(0), bytesSent(0), clientsAccepted(0) {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    clients[i] = HTTP_TOKEN_NONE;
+    fresh[i] = false;
+  }
+}
+
+void EventStream::accept(HttpRequest& req) {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (server->isOpen(clients[i])) continue;
+
+    server->addHeader(req, "Cache-Control", "no-cache");
+    clients[i] = server->beginStream(req, "text/event-stream");
+    fresh[i] = true;
+    clientsAccepted++;
+    writeTo(i, EVENTS_RETRY, sizeof(EVENTS_RETRY) - 1);
+    return;
+  }
+
+  // Усі місця зайняті - браузер спробує знову через retry
+  server->send(req, 503);
+}
+
+bool EventStream::hasClients() {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (server->isOpen(clients[i])) return true;
+  }
+  return false;
+}
+
+bool EventStream::hasFreshClients() {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (fresh[i] && server->isOpen(clients[i])) return true;
+  }
+  return false;
+}
+
+uint8_t EventStream::getClientCount() {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (server->isOpen(clients[i])) count++;
+  }
+  return count;
+}
+
+bool EventStream::writeTo(uint8_t slot, const char* data, size_t length) {
+  // Сервер сам закриває клієнта, що не приймає дані
+  if (!server->write(clients[slot], data, length)) {
+    clients[slot] = HTTP_TOKEN_NONE;
+    return false;
+  }
+  bytesSent += length;
+  lastWrite = millis();
+  return true;
+}
+
+void EventStream::broadcast(const char* data, size_t length) {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (!fresh[i] && server->isOpen(clients[i]) && writeTo(i, data, length)) {
+      eventsSent++;
+    }
+  }
+}
+
+void EventStream::sendToFresh(const char* data, size_t length) {
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (fresh[i] && server->isOpen(clients[i])) {
+      fresh[i] = false;
+      if (writeTo(i, data, length)) {
+        eventsSent++;
+      }
+    }
+  }
+}
+
+void EventStream::heartbeat(uint32_t now) {
+  if (now - lastWrite < EVENTS_HEARTBEAT_MS) return;
+
+  for (uint8_t i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+    if (server->isOpen(clients[i])) {
+      writeTo(i, EVENTS_HEARTBEAT, sizeof(EVENTS_HEARTBEAT) - 1);
+    }
+  }
+  lastWrite = now;
+}
\ No newline at end of file
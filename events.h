@@ -0,0 +1,71 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "http_server.h"
+
+// Групи полів потоку подій; у подію потрапляють лише змінені
+enum EventGroup : uint8_t {
+  EVENT_GROUP_SCREEN  = 1 << 0,
+  EVENT_GROUP_ALARM   = 1 << 1,
+  EVENT_GROUP_WEATHER = 1 << 2,
+  EVENT_GROUP_SENSOR  = 1 << 3,
+  EVENT_GROUP_WIFI    = 1 << 4,
+  EVENT_GROUP_ALL     = 0x1F
+};
+
+// Знімок для порівняння: значення округлені настільки, наскільки їх
+// показує сторінка, щоб шум датчика і RSSI не будив клієнтів
+struct EventState {
+  uint8_t screen;
+  uint8_t alarmHour;
+  uint8_t alarmMinute;
+  bool alarmEnabled;
+  bool alarmTriggered;
+  bool alarmRinging;
+  uint32_t weatherStamp;   // WeatherData::lastUpdate
+  int32_t pressureDeciHpa;
+  int16_t temperatureDeci;
+  uint8_t linkState;
+  int8_t rssiBucket;       // RSSI з кроком EVENTS_RSSI_STEP
+};
+
+uint8_t diffEventState(const EventState& a, const EventState& b);
+
+// Потік Server-Sent Events. Кожен клієнт - довге з'єднання HttpServer,
+// тож потоки ділять пул з'єднань зі звичайними запитами.
+class EventStream {
+private:
+  HttpServer* server;
+  HttpToken clients[EVENTS_MAX_CLIENTS];
+  bool fresh[EVENTS_MAX_CLIENTS];  // ще не отримав повного стану
+  uint32_t lastWrite;
+
+  uint32_t eventsSent;
+  uint32_t bytesSent;
+  uint32_t clientsAccepted;
+
+  bool writeTo(uint8_t slot, const char* data, size_t length);
+
+public:
+  EventStream(HttpServer* http);
+
+  // Обробник GET /events: з'єднання переходить у потік
+  void accept(HttpRequest& req);
+  bool hasClients();
+  bool hasFreshClients();
+
+  // data - вже готовий рядок "data: ...\n\n"
+  void broadcast(const char* data, size_t length);
+  void sendToFresh(const char* data, size_t length);
+  // Коментар-пульс, якщо давно нічого не писали
+  void heartbeat(uint32_t now);
+
+  uint8_t getClientCount();
+  uint32_t getEventsSent() const { return eventsSent; }
+  uint32_t getBytesSent() const { return bytesSent; }
+  uint32_t getClientsAccepted() const { return clientsAccepted; }
+};
+
+#endif // EVENTS_H
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "history.h"
+
+HistoryStore::HistoryStore() : log(this), lock(NULL), ready(false) {
+}
+
+bool HistoryStore::openTier(uint8_t tier) {
+  char path[24];
+  snprintf(path, sizeof(path), HISTORY_PATH_FORMAT, tier);
+  size_t size = (size_t)HISTORY_TIERS[tier].slots * sizeof(HistoryBlock);
+
+  // Кільце створюється нулями на весь розмір: нульовий слот - порожній
+  if (!LittleFS.exists(path) || LittleFS.open(path, "r").size() != size) {
+    File file = LittleFS.open(path, "w");
+    if (!file) return false;
+
+    HistoryBlock empty;
+    memset(&empty, 0, sizeof(empty));
+    for (uint16_t i = 0; i < HISTORY_TIERS[tier].slots; i++) {
+      file.write((const uint8_t*)&empty, sizeof(empty));
+    }
+    file.close();
+  }
+
+  files[tier] = LittleFS.open(path, "r+");
+  return (bool)files[tier];
+}
+
+bool HistoryStore::begin() {
+  if (ready) return true;
+
+  // Розділ уже змонтовано в RingtoneStore::begin(), повторний виклик лише перевіряє
+  if (!LittleFS.begin(true)) return false;
+
+  for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+    if (!openTier(tier)) return false;
+  }
+
+  lock = xSemaphoreCreateMutex();
+  log.begin();
+  ready = true;
+  return true;
+}
+
+void HistoryStore::add(time_t now, float pressurePa, float temperature) {
+  if (!ready || now < CLOCK_VALID_EPOCH) return;
+
+  HistoryPoint point;
+  point.time = (uint32_t)now;
+  point.pressurePa = lroundf(pressurePa);
+  point.temperatureDeci = (int16_t)lroundf(temperature * 10.0f);
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  log.add(point);
+  xSemaphoreGive(lock);
+}
+
+void HistoryStore::open(HistoryCursor& cursor, uint32_t from, uint32_t to, uint32_t resolution) {
+  if (!ready) {
+    cursor.done = true;
+    cursor.step = resolution;
+    return;
+  }
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  log.open(cursor, from, to, resolution);
+  xSemaphoreGive(lock);
+}
+
+size_t HistoryStore::read(HistoryCursor& cursor, HistoryPoint* out, size_t max) {
+  if (!ready) return 0;
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  size_t count = log.read(cursor, out, max);
+  xSemaphoreGive(lock);
+  return count;
+}
+
+uint32_t HistoryStore::getLatestTime() {
+  if (!ready) return 0;
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint32_t latest = log.getLatestTime();
+  xSemaphoreGive(lock);
+  return latest;
+}
+
+bool HistoryStore::readBlock(uint8_t tier, uint16_t slot, HistoryBlock& block) {
+  File& file = files[tier];
+  return file.seek((uint32_t)slot * sizeof(HistoryBlock)) &&
+         file.read((uint8_t*)&block, sizeof(block)) == sizeof(block);
+}
+
+bool HistoryStore::writeBlock(uint8_t tier, uint16_t slot, const HistoryBlock& block) {
+  File& file = files[tier];
+  if (!file.seek((uint32_t)slot * sizeof(HistoryBlock)) ||
+      file.write((const uint8_t*)&block, sizeof(block)) != sizeof(block)) {
+    return false;
+  }
+  // До flush() запис лише в кеші файлу - обрив живлення його загубить
+  file.flush();
+  return true;
+}
\ No newline at end of file
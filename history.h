@@ -0,0 +1,42 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "timeseries.h"
+
+// Носій журналу на LittleFS: кожен рівень - файл рівно на
+// HISTORY_TIERS[i].slots блоків, створений одразу повністю. Блоки
+// переписуються по колу на своїх місцях, тож файл не росте і не
+// видаляється, а записи розходяться по всьому кільцю.
+// Пише задача датчика, читає задача "net" - журнал під м'ютексом.
+class HistoryStore : public HistoryMedium {
+private:
+  HistoryLog log;
+  File files[HISTORY_TIER_COUNT];
+  SemaphoreHandle_t lock;
+  bool ready;
+
+  bool openTier(uint8_t tier);
+
+public:
+  HistoryStore();
+
+  bool begin();
+
+  // Вибірка датчика; поки годинник не синхронізовано, не пишеться
+  void add(time_t now, float pressurePa, float temperature);
+
+  void open(HistoryCursor& cursor, uint32_t from, uint32_t to, uint32_t resolution);
+  size_t read(HistoryCursor& cursor, HistoryPoint* out, size_t max);
+
+  uint32_t getLatestTime();
+  uint32_t getBlockWrites() const { return log.getBlockWrites(); }
+  bool isReady() const { return ready; }
+
+  bool readBlock(uint8_t tier, uint16_t slot, HistoryBlock& block) override;
+  bool writeBlock(uint8_t tier, uint16_t slot, const HistoryBlock& block) override;
+};
+
+#endif // HISTORY_H
\ No newline at end of file
@@ -0,0 +1,800 @@
+#include "http_server.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+#include <stdarg.h>
+
+static const uint32_t HTTP_HISTOGRAM_LIMITS[HTTP_HISTOGRAM_BUCKETS - 1] = {5, 20, 50, 200};
+
+// Пул зайнятий: коротка відмова замість очікування в черзі listen
+static const char HTTP_BUSY_RESPONSE[] =
+  "HTTP/1.1 503 Service Unavailable\r\n"
+  "Content-Length: 0\r\n"
+  "Retry-After: 1\r\n"
+  "Connection: close\r\n"
+  "\r\n";
+
+#define HTTP_RECV_CHUNK 512
+
+// Частина chunked: довжина рівно 4 hex-цифри, щоб не зсувати дані,
+// що source уже записав за нею; HTTP_OUT_MAX мусить бути < 0x10000
+#define HTTP_CHUNK_HEADER 6
+static const char HTTP_CHUNK_LAST[] = "0\r\n\r\n";
+
+static bool wouldBlock() {
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+static const char* statusText(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 202: return "Accepted";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 409: return "Conflict";
+    case 413: return "Payload Too Large";
+    case 431: return "Request Header Fields Too Large";
+    case 500: return "Internal Server Error";
+    case 501: return "Not Implemented";
+    case 503: return "Service Unavailable";
+    case 504: return "Gateway Timeout";
+    default:  return "";
+  }
+}
+
+static HttpMethod parseMethod(const char* name) {
+  if (strcmp(name, "GET") == 0) return HTTP_METHOD_GET;
+  if (strcmp(name, "POST") == 0) return HTTP_METHOD_POST;
+  if (strcmp(name, "DELETE") == 0) return HTTP_METHOD_DELETE;
+  return HTTP_METHOD_OTHER;
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static void urlDecode(const char* p, const char* end, String& value) {
+  value.reserve(end - p);
+  while (p < end) {
+    if (*p == '+') {
+      value += ' ';
+    } else if (*p == '%' && end - p >= 3 && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0) {
+      value += (char)(hexValue(p[1]) << 4 | hexValue(p[2]));
+      p += 2;
+    } else {
+      value += *p;
+    }
+    p++;
+  }
+}
+
+// Шукає name у "a=b&c=d"; ключі порівнюються як є, без декодування
+static bool findArg(const char* params, size_t length, const char* name, String& value) {
+  size_t nameLength = strlen(name);
+  const char* p = params;
+  const char* end = params + length;
+
+  while (p < end) {
+    const char* amp = (const char*)memchr(p, '&', end - p);
+    const char* pairEnd = amp != NULL ? amp : end;
+    const char* eq = (const char*)memchr(p, '=', pairEnd - p);
+    const char* keyEnd = eq != NULL ? eq : pairEnd;
+
+    if ((size_t)(keyEnd - p) == nameLength && strncmp(p, name, nameLength) == 0) {
+      if (eq != NULL) {
+        urlDecode(eq + 1, pairEnd, value);
+      }
+      return true;
+    }
+    p = pairEnd + 1;
+  }
+  return false;
+}
+
+String HttpRequest::arg(const char* name) const {
+  String value;
+  if (findArg(query, strlen(query), name, value)) {
+    return value;
+  }
+  if (strncmp(contentType, "application/x-www-form-urlencoded", 33) == 0) {
+    findArg(body, bodyLength, name, value);
+  }
+  return value;
+}
+
+HttpServer::HttpServer(uint16_t serverPort)
+  : port(serverPort), listenFd(-1), routeCount(0), notFound(nullptr),
+    requests(0), rejected(0), reused(0), timeouts(0), peakConnections(0),
+    lastResponseUs(0), maxResponseUs(0), maxHandlerUs(0) {
+  memset(responseHistogram, 0, sizeof(responseHistogram));
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    conns[i].fd = -1;
+    conns[i].state = HTTP_CONN_FREE;
+    conns[i].generation = 0;
+  }
+}
+
+void HttpServer::on(const char* path, HttpMethod method, HttpHandler handler,
+                    HttpBodyHandler bodyHandler) {
+  if (routeCount >= HTTP_MAX_ROUTES) return;
+
+  HttpRoute& route = routes[routeCount++];
+  route.path = path;
+  route.method = method;
+  route.handler = handler;
+  route.bodyHandler = bodyHandler;
+}
+
+bool HttpServer::begin() {
+  if (listenFd >= 0) return true;
+
+  int fd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return false;
+
+  int enable = 1;
+  lwip_setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+
+  if (lwip_bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+      lwip_listen(fd, HTTP_MAX_CONNECTIONS) < 0) {
+    lwip_close(fd);
+    return false;
+  }
+
+  lwip_fcntl(fd, F_SETFL, O_NONBLOCK);
+  listenFd = fd;
+  return true;
+}
+
+void HttpServer::service(uint32_t timeoutMs) {
+  if (listenFd < 0) {
+    vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+    return;
+  }
+
+  fd_set readSet;
+  fd_set writeSet;
+  FD_ZERO(&readSet);
+  FD_ZERO(&writeSet);
+  FD_SET(listenFd, &readSet);
+  int maxFd = listenFd;
+
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    HttpConnection& conn = conns[i];
+    if (conn.state == HTTP_CONN_FREE) continue;
+
+    // Читання стежимо й там, де даних не чекаємо: так видно закриття
+    if (conn.state != HTTP_CONN_WRITE) {
+      FD_SET(conn.fd, &readSet);
+    }
+    if (conn.outSent < conn.outLength || conn.payloadSent < conn.payloadLength) {
+      FD_SET(conn.fd, &writeSet);
+    }
+    if (conn.fd > maxFd) {
+      maxFd = conn.fd;
+    }
+  }
+
+  struct timeval timeout;
+  timeout.tv_sec = timeoutMs / 1000;
+  timeout.tv_usec = (timeoutMs % 1000) * 1000;
+  int ready = lwip_select(maxFd + 1, &readSet, &writeSet, NULL, &timeout);
+  uint32_t now = millis();
+
+  if (ready > 0) {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+      HttpConnection& conn = conns[i];
+      if (conn.state == HTTP_CONN_FREE) continue;
+
+      int fd = conn.fd;
+      if (FD_ISSET(fd, &writeSet)) {
+        flush(conn, now);
+      }
+      if (conn.state != HTTP_CONN_FREE && FD_ISSET(fd, &readSet)) {
+        readFrom(conn, now);
+      }
+    }
+
+    // Нові з'єднання - після проходу, бо їхні сокети не було в наборах
+    if (FD_ISSET(listenFd, &readSet)) {
+      acceptClient(now);
+    }
+  }
+
+  // Обробники могли оновити lastActivity пізніше за now
+  expire(millis());
+}
+
+void HttpServer::acceptClient(uint32_t now) {
+  for (;;) {
+    struct sockaddr_in addr;
+    socklen_t addrLength = sizeof(addr);
+    int fd = lwip_accept(listenFd, (struct sockaddr*)&addr, &addrLength);
+    if (fd < 0) return;
+
+    HttpConnection* conn = NULL;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+      if (conns[i].state == HTTP_CONN_FREE) {
+        conn = &conns[i];
+        break;
+      }
+    }
+
+    if (conn == NULL) {
+      lwip_send(fd, HTTP_BUSY_RESPONSE, sizeof(HTTP_BUSY_RESPONSE) - 1, MSG_DONTWAIT);
+      lwip_close(fd);
+      rejected++;
+      continue;
+    }
+
+    lwip_fcntl(fd, F_SETFL, O_NONBLOCK);
+    int enable = 1;
+    lwip_setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+    conn->fd = fd;
+    conn->state = HTTP_CONN_HEAD;
+    conn->lastActivity = now;
+    conn->served = 0;
+    conn->deferred = false;
+    conn->route = NULL;
+    conn->headLength = 0;
+    conn->headersLength = 0;
+    conn->outLength = 0;
+    conn->outSent = 0;
+    conn->payload = NULL;
+    conn->payloadLength = 0;
+    conn->payloadSent = 0;
+
+    uint8_t count = getConnectionCount();
+    if (count > peakConnections) {
+      peakConnections = count;
+    }
+  }
+}
+
+void HttpServer::readFrom(HttpConnection& conn, uint32_t now) {
+  if (conn.state == HTTP_CONN_HEAD) {
+    int n = lwip_recv(conn.fd, conn.head + conn.headLength,
+                      HTTP_HEAD_MAX - 1 - conn.headLength, 0);
+    if (n <= 0) {
+      if (n == 0 || !wouldBlock()) drop(conn);
+      return;
+    }
+    if (conn.headLength == 0) {
+      conn.requestStart = micros();
+    }
+    conn.headLength += n;
+    conn.lastActivity = now;
+    parseHead(conn);
+    return;
+  }
+
+  uint8_t chunk[HTTP_RECV_CHUNK];
+  int n = lwip_recv(conn.fd, chunk, sizeof(chunk), 0);
+  if (n <= 0) {
+    if (n == 0 || !wouldBlock()) drop(conn);
+    return;
+  }
+
+  // Поза тілом клієнт нічого не має надсилати - відкидаємо
+  if (conn.state == HTTP_CONN_BODY) {
+    conn.lastActivity = now;
+    feedBody(conn, chunk, n);
+  }
+}
+
+void HttpServer::parseHead(HttpConnection& conn) {
+  HttpRequest& req = conn.request;
+  req.method = HTTP_METHOD_OTHER;
+  req.path = "/";
+  req.query = "";
+  req.contentType = "";
+  req.ifNoneMatch = "";
+  req.contentLength = 0;
+  conn.body[0] = '\0';
+  req.body = conn.body;
+  req.bodyLength = 0;
+  req.keepAlive = false;
+  req.slot = &conn - conns;
+
+  conn.head[conn.headLength] = '\0';
+  char* headEnd = strstr(conn.head, "\r\n\r\n");
+  if (headEnd == NULL) {
+    if (conn.headLength >= HTTP_HEAD_MAX - 1) {
+      fail(conn, 431);
+    }
+    return;
+  }
+  char* bodyStart = headEnd + 4;
+  size_t leftover = conn.head + conn.headLength - bodyStart;
+  headEnd[2] = '\0';
+
+  // Рядок запиту: МЕТОД ціль ВЕРСІЯ
+  char* line = conn.head;
+  char* next = strstr(line, "\r\n");
+  *next = '\0';
+  next += 2;
+
+  char* target = strchr(line, ' ');
+  char* version = target != NULL ? strchr(target + 1, ' ') : NULL;
+  if (version == NULL) {
+    fail(conn, 400);
+    return;
+  }
+  *target++ = '\0';
+  *version++ = '\0';
+
+  req.method = parseMethod(line);
+  // HTTP/1.0 тримає з'єднання лише з явним keep-alive
+  req.keepAlive = strcmp(version, "HTTP/1.1") == 0;
+  char* query = strchr(target, '?');
+  if (query != NULL) {
+    *query = '\0';
+    req.query = query + 1;
+  }
+  req.path = target;
+
+  // Заголовки: лише ті, що потрібні серверу й обробникам
+  while (*next != '\0') {
+    char* header = next;
+    char* eol = strstr(header, "\r\n");
+    *eol = '\0';
+    next = eol + 2;
+
+    char* colon = strchr(header, ':');
+    if (colon == NULL) continue;
+    *colon = '\0';
+    char* value = colon + 1;
+    while (*value == ' ') value++;
+
+    if (strcasecmp(header, "Content-Length") == 0) {
+      req.contentLength = strtoul(value, NULL, 10);
+    } else if (strcasecmp(header, "Content-Type") == 0) {
+      req.contentType = value;
+    } else if (strcasecmp(header, "If-None-Match") == 0) {
+      req.ifNoneMatch = value;
+    } else if (strcasecmp(header, "Connection") == 0) {
+      if (strcasecmp(value, "close") == 0) req.keepAlive = false;
+      if (strcasecmp(value, "keep-alive") == 0) req.keepAlive = true;
+    } else if (strcasecmp(header, "Transfer-Encoding") == 0) {
+      // Браузер шле тіла з довжиною; chunked від клієнта не підтримуємо
+      fail(conn, 501);
+      return;
+    }
+  }
+
+  conn.route = NULL;
+  for (uint8_t i = 0; i < routeCount; i++) {
+    const HttpRoute& route = routes[i];
+    if (strcmp(route.path, req.path) == 0 &&
+        (route.method == HTTP_METHOD_ANY || route.method == req.method)) {
+      conn.route = &route;
+      break;
+    }
+  }
+
+  if (conn.served > 0) {
+    reused++;
+  }
+  conn.served++;
+  conn.bodyReceived = 0;
+  conn.headersLength = 0;
+
+  bool streamed = conn.route != NULL && conn.route->bodyHandler;
+  if (!streamed && req.contentLength >= HTTP_BODY_MAX) {
+    fail(conn, 413);
+    return;
+  }
+
+  conn.state = HTTP_CONN_BODY;
+  if (streamed) {
+    conn.route->bodyHandler(req, HTTP_BODY_START, NULL, 0);
+  }
+  // Початок тіла міг прийти разом із заголовками
+  feedBody(conn, (const uint8_t*)bodyStart, leftover);
+}
+
+void HttpServer::feedBody(HttpConnection& conn, const uint8_t* data, size_t length) {
+  HttpRequest& req = conn.request;
+  bool streamed = conn.route != NULL && conn.route->bodyHandler;
+
+  // Конвеєрні запити не підтримуються: усе після тіла відкидається
+  size_t take = min((uint32_t)length, req.contentLength - conn.bodyReceived);
+  if (take > 0) {
+    if (streamed) {
+      conn.route->bodyHandler(req, HTTP_BODY_DATA, data, take);
+    } else {
+      memcpy(conn.body + conn.bodyReceived, data, take);
+    }
+    conn.bodyReceived += take;
+  }
+  if (conn.bodyReceived < req.contentLength) return;
+
+  if (streamed) {
+    conn.route->bodyHandler(req, HTTP_BODY_END, NULL, 0);
+  } else {
+    conn.body[conn.bodyReceived] = '\0';
+    req.bodyLength = conn.bodyReceived;
+  }
+  dispatch(conn);
+}
+
+void HttpServer::dispatch(HttpConnection& conn) {
+  HttpRequest& req = conn.request;
+  conn.state = HTTP_CONN_HANDLER;
+  conn.deferred = false;
+  conn.lastActivity = millis();
+
+  uint32_t start = micros();
+  if (conn.route != NULL) {
+    conn.route->handler(req);
+  } else if (notFound) {
+    notFound(req);
+  } else {
+    send(req, 404, "text/plain", statusText(404));
+  }
+  uint32_t elapsed = micros() - start;
+  if (elapsed > maxHandlerUs) {
+    maxHandlerUs = elapsed;
+  }
+
+  // Обробник не відповів і не відклав відповідь
+  if (conn.state == HTTP_CONN_HANDLER && !conn.deferred) {
+    fail(conn, 500);
+  }
+}
+
+void HttpServer::flush(HttpConnection& conn, uint32_t now) {
+  for (;;) {
+    while (conn.outSent < conn.outLength) {
+      int n = lwip_send(conn.fd, conn.out + conn.outSent, conn.outLength - conn.outSent, MSG_DONTWAIT);
+      if (n <= 0) {
+        if (n < 0 && wouldBlock()) return;
+        drop(conn);
+        return;
+      }
+      conn.outSent += n;
+      conn.lastActivity = now;
+    }
+
+    while (conn.payloadSent < conn.payloadLength) {
+      int n = lwip_send(conn.fd, conn.payload + conn.payloadSent,
+                        conn.payloadLength - conn.payloadSent, MSG_DONTWAIT);
+      if (n <= 0) {
+        if (n < 0 && wouldBlock()) return;
+        drop(conn);
+        return;
+      }
+      conn.payloadSent += n;
+      conn.lastActivity = now;
+    }
+
+    // Буфер пішов цілком - наступна частина, поки сокет приймає
+    if (!conn.source) break;
+    nextChunk(conn);
+  }
+
+  if (conn.state == HTTP_CONN_WRITE) {
+    finishResponse(conn);
+  } else if (conn.state == HTTP_CONN_STREAM) {
+    conn.outLength = 0;
+    conn.outSent = 0;
+  }
+}
+
+void HttpServer::nextChunk(HttpConnection& conn) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+
+  conn.outLength = 0;
+  conn.outSent = 0;
+  size_t room = HTTP_OUT_MAX - HTTP_CHUNK_HEADER - 2 - (sizeof(HTTP_CHUNK_LAST) - 1);
+  size_t length = conn.source(conn.out + HTTP_CHUNK_HEADER, room);
+
+  if (length == 0 || length > room) {
+    conn.source = nullptr;
+    appendOut(conn, HTTP_CHUNK_LAST, sizeof(HTTP_CHUNK_LAST) - 1);
+    return;
+  }
+  for (uint8_t i = 0; i < 4; i++) {
+    conn.out[i] = HEX_DIGITS[(length >> (12 - 4 * i)) & 0xF];
+  }
+  conn.out[4] = '\r';
+  conn.out[5] = '\n';
+  conn.outLength = HTTP_CHUNK_HEADER + length;
+  appendOut(conn, "\r\n", 2);
+}
+
+void HttpServer::finishResponse(HttpConnection& conn) {
+  uint32_t elapsed = micros() - conn.requestStart;
+  requests++;
+  lastResponseUs = elapsed;
+  if (elapsed > maxResponseUs) {
+    maxResponseUs = elapsed;
+  }
+  uint32_t ms = elapsed / 1000;
+  uint8_t bucket = 0;
+  while (bucket < HTTP_HISTOGRAM_BUCKETS - 1 && ms > HTTP_HISTOGRAM_LIMITS[bucket]) {
+    bucket++;
+  }
+  responseHistogram[bucket]++;
+
+  if (!conn.request.keepAlive) {
+    drop(conn);
+    return;
+  }
+
+  // Наступний запит на тому ж з'єднанні
+  conn.state = HTTP_CONN_HEAD;
+  conn.headLength = 0;
+  conn.outLength = 0;
+  conn.outSent = 0;
+  conn.payload = NULL;
+  conn.payloadLength = 0;
+  conn.payloadSent = 0;
+}
+
+void HttpServer::expire(uint32_t now) {
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    HttpConnection& conn = conns[i];
+    uint32_t idle = now - conn.lastActivity;
+
+    switch (conn.state) {
+      case HTTP_CONN_HEAD:
+        // Порожній буфер - просто keep-alive без нових запитів
+        if (idle > HTTP_IDLE_TIMEOUT_MS) {
+          if (conn.headLength > 0) timeouts++;
+          drop(conn);
+        }
+        break;
+
+      case HTTP_CONN_BODY:
+      case HTTP_CONN_WRITE:
+        if (idle > HTTP_IDLE_TIMEOUT_MS) {
+          timeouts++;
+          drop(conn);
+        }
+        break;
+
+      case HTTP_CONN_HANDLER:
+        if (idle > HTTP_DEFER_TIMEOUT_MS) {
+          timeouts++;
+          fail(conn, 504);
+        }
+        break;
+
+      case HTTP_CONN_STREAM:
+        if (conn.outSent < conn.outLength && idle > HTTP_IDLE_TIMEOUT_MS) {
+          drop(conn);
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+void HttpServer::drop(HttpConnection& conn) {
+  if (conn.state == HTTP_CONN_FREE) return;
+
+  if (conn.state == HTTP_CONN_BODY && conn.route != NULL && conn.route->bodyHandler) {
+    conn.route->bodyHandler(conn.request, HTTP_BODY_ABORT, NULL, 0);
+  }
+  lwip_close(conn.fd);
+  conn.fd = -1;
+  conn.state = HTTP_CONN_FREE;
+  conn.source = nullptr;
+  conn.generation++;
+}
+
+void HttpServer::fail(HttpConnection& conn, int code) {
+  // Після помилки стан розбору ненадійний - з'єднання закриваємо
+  conn.request.keepAlive = false;
+  conn.headersLength = 0;
+  send(conn.request, code, "text/plain", statusText(code));
+}
+
+bool HttpServer::appendOut(HttpConnection& conn, const char* data, size_t length) {
+  if (length > (size_t)(HTTP_OUT_MAX - conn.outLength)) {
+    return false;
+  }
+  memcpy(conn.out + conn.outLength, data, length);
+  conn.outLength += length;
+  return true;
+}
+
+bool HttpServer::appendFormat(HttpConnection& conn, const char* format, ...) {
+  size_t room = HTTP_OUT_MAX - conn.outLength;
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(conn.out + conn.outLength, room, format, args);
+  va_end(args);
+
+  if (n < 0 || (size_t)n >= room) {
+    return false;
+  }
+  conn.outLength += n;
+  return true;
+}
+
+bool HttpServer::beginResponse(HttpConnection& conn, int code, const char* contentType,
+                               int32_t contentLength) {
+  conn.outLength = 0;
+  conn.outSent = 0;
+  conn.payload = NULL;
+  conn.payloadLength = 0;
+  conn.payloadSent = 0;
+  conn.source = nullptr;
+  conn.deferred = false;
+
+  bool ok = appendFormat(conn, "HTTP/1.1 %d %s\r\n", code, statusText(code));
+  if (contentType != NULL) {
+    ok = ok && appendFormat(conn, "Content-Type: %s\r\n", contentType);
+  }
+  if (contentLength >= 0) {
+    ok = ok && appendFormat(conn, "Content-Length: %ld\r\n", (long)contentLength);
+  }
+  ok = ok && appendFormat(conn, "Connection: %s\r\n",
+                          conn.request.keepAlive ? "keep-alive" : "close");
+  ok = ok && appendOut(conn, conn.headers, conn.headersLength);
+  ok = ok && appendOut(conn, "\r\n", 2);
+  conn.headersLength = 0;
+  return ok;
+}
+
+void HttpServer::addHeader(HttpRequest& req, const char* name, const char* value) {
+  HttpConnection& conn = conns[req.slot];
+  int n = snprintf(conn.headers + conn.headersLength, HTTP_EXTRA_HEADERS_MAX - conn.headersLength,
+                   "%s: %s\r\n", name, value);
+  if (n > 0 && n < HTTP_EXTRA_HEADERS_MAX - conn.headersLength) {
+    conn.headersLength += n;
+  }
+}
+
+void HttpServer::send(HttpRequest& req, int code, const char* contentType,
+                      const char* body, size_t length) {
+  HttpConnection& conn = conns[req.slot];
+
+  if (!beginResponse(conn, code, contentType, length) || !appendOut(conn, body, length)) {
+    // Відповідь не вміщається в буфер з'єднання
+    conn.request.keepAlive = false;
+    beginResponse(conn, 500, "text/plain", 0);
+  }
+  conn.state = HTTP_CONN_WRITE;
+  flush(conn, millis());
+}
+
+char* HttpServer::reserve(HttpRequest& req, int code, const char* contentType, size_t length) {
+  HttpConnection& conn = conns[req.slot];
+
+  // +1 - serializeJson завжди дописує '\0', у відповідь він не йде
+  if (!beginResponse(conn, code, contentType, length) ||
+      length + 1 > (size_t)(HTTP_OUT_MAX - conn.outLength)) {
+    conn.request.keepAlive = false;
+    beginResponse(conn, 500, "text/plain", 0);
+    conn.state = HTTP_CONN_WRITE;
+    flush(conn, millis());
+    return NULL;
+  }
+
+  char* body = conn.out + conn.outLength;
+  conn.outLength += length;
+  return body;
+}
+
+void HttpServer::commit(HttpRequest& req) {
+  HttpConnection& conn = conns[req.slot];
+  conn.state = HTTP_CONN_WRITE;
+  flush(conn, millis());
+}
+
+void HttpServer::sendStatic(HttpRequest& req, int code, const char* contentType,
+                            const uint8_t* data, size_t length) {
+  HttpConnection& conn = conns[req.slot];
+
+  if (!beginResponse(conn, code, contentType, length)) {
+    conn.request.keepAlive = false;
+    beginResponse(conn, 500, "text/plain", 0);
+  } else {
+    conn.payload = data;
+    conn.payloadLength = length;
+  }
+  conn.state = HTTP_CONN_WRITE;
+  flush(conn, millis());
+}
+
+void HttpServer::sendChunked(HttpRequest& req, int code, const char* contentType,
+                             HttpChunkSource source) {
+  HttpConnection& conn = conns[req.slot];
+
+  addHeader(req, "Transfer-Encoding", "chunked");
+  if (!beginResponse(conn, code, contentType, -1)) {
+    fail(conn, 500);
+    return;
+  }
+  conn.source = source;
+  conn.state = HTTP_CONN_WRITE;
+  flush(conn, millis());
+}
+
+HttpToken HttpServer::tokenOf(const HttpConnection& conn) const {
+  return (HttpToken)((&conn - conns) << 8 | conn.generation);
+}
+
+HttpConnection* HttpServer::lookup(HttpToken token) {
+  uint8_t slot = token >> 8;
+  if (slot >= HTTP_MAX_CONNECTIONS) return NULL;
+
+  HttpConnection& conn = conns[slot];
+  if (conn.state == HTTP_CONN_FREE || conn.generation != (token & 0xFF)) {
+    return NULL;
+  }
+  return &conn;
+}
+
+HttpToken HttpServer::defer(HttpRequest& req) {
+  HttpConnection& conn = conns[req.slot];
+  conn.deferred = true;
+  return tokenOf(conn);
+}
+
+HttpRequest* HttpServer::resume(HttpToken token) {
+  HttpConnection* conn = lookup(token);
+  if (conn == NULL || conn->state != HTTP_CONN_HANDLER || !conn->deferred) {
+    return NULL;
+  }
+  return &conn->request;
+}
+
+HttpToken HttpServer::beginStream(HttpRequest& req, const char* contentType) {
+  HttpConnection& conn = conns[req.slot];
+
+  conn.request.keepAlive = true;
+  if (!beginResponse(conn, 200, contentType, -1)) {
+    fail(conn, 500);
+    return HTTP_TOKEN_NONE;
+  }
+  conn.state = HTTP_CONN_STREAM;
+  flush(conn, millis());
+  return conn.state == HTTP_CONN_STREAM ? tokenOf(conn) : HTTP_TOKEN_NONE;
+}
+
+bool HttpServer::write(HttpToken token, const char* data, size_t length) {
+  HttpConnection* conn = lookup(token);
+  if (conn == NULL || conn->state != HTTP_CONN_STREAM) return false;
+
+  uint32_t now = millis();
+  if (conn->outSent == conn->outLength) {
+    conn->outLength = 0;
+    conn->outSent = 0;
+    conn->lastActivity = now;
+  } else if (conn->outSent > 0) {
+    memmove(conn->out, conn->out + conn->outSent, conn->outLength - conn->outSent);
+    conn->outLength -= conn->outSent;
+    conn->outSent = 0;
+  }
+
+  // Клієнт, що не встигає читати, відключається, а не гальмує інших
+  if (!appendOut(*conn, data, length)) {
+    drop(*conn);
+    return false;
+  }
+  flush(*conn, now);
+  return conn->state == HTTP_CONN_STREAM;
+}
+
+uint8_t HttpServer::getConnectionCount() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    if (conns[i].state != HTTP_CONN_FREE) count++;
+  }
+  return count;
+}
\ No newline at end of file
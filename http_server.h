@@ -0,0 +1,197 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include "config.h"
+
+// Час від першого байта запиту до останнього байта відповіді, мс:
+// <=5, <=20, <=50, <=200, >200
+#define HTTP_HISTOGRAM_BUCKETS 5
+
+enum HttpMethod : uint8_t {
+  HTTP_METHOD_ANY = 0,
+  HTTP_METHOD_GET,
+  HTTP_METHOD_POST,
+  HTTP_METHOD_DELETE,
+  HTTP_METHOD_OTHER
+};
+
+// Етапи потокового тіла, як UPLOAD_FILE_* у WebServer
+enum HttpBodyEvent : uint8_t {
+  HTTP_BODY_START = 0,
+  HTTP_BODY_DATA,
+  HTTP_BODY_END,
+  HTTP_BODY_ABORT
+};
+
+// Посилання на відкладений запит або потік: слот і покоління, тож
+// токен закритого з'єднання не влучить у нове на тому ж слоті
+typedef uint16_t HttpToken;
+#define HTTP_TOKEN_NONE 0xFFFF
+
+// Розібраний запит. Рядки вказують у буфер з'єднання і живуть,
+// доки на запит не відповіли
+struct HttpRequest {
+  HttpMethod method;
+  const char* path;
+  const char* query;         // без '?', "" якщо немає
+  const char* contentType;
+  const char* ifNoneMatch;
+  uint32_t contentLength;
+  char* body;                // буферизоване тіло з '\0' в кінці, порожнє, якщо потокове;
+                             // змінюване - ArduinoJson розбирає його без копій рядків
+  uint32_t bodyLength;
+  bool keepAlive;
+  uint8_t slot;
+
+  // Параметр з query або з тіла форми x-www-form-urlencoded
+  String arg(const char* name) const;
+};
+
+typedef std::function<void(HttpRequest&)> HttpHandler;
+typedef std::function<void(HttpRequest&, HttpBodyEvent, const uint8_t*, size_t)> HttpBodyHandler;
+// Пише наступну частину тіла не довше room байтів; 0 - тіло закінчилось
+typedef std::function<size_t(char* buffer, size_t room)> HttpChunkSource;
+
+struct HttpRoute {
+  const char* path;
+  HttpMethod method;
+  HttpHandler handler;
+  HttpBodyHandler bodyHandler;  // тіло йде обробнику частинами, а не в буфер
+};
+
+enum HttpConnState : uint8_t {
+  HTTP_CONN_FREE = 0,
+  HTTP_CONN_HEAD,      // читаємо рядок запиту і заголовки
+  HTTP_CONN_BODY,
+  HTTP_CONN_HANDLER,   // обробник відклав відповідь
+  HTTP_CONN_WRITE,
+  HTTP_CONN_STREAM     // довге з'єднання, пишемо через write()
+};
+
+struct HttpConnection {
+  int fd;
+  HttpConnState state;
+  uint8_t generation;
+  uint32_t lastActivity;
+  uint32_t requestStart;       // мкс, перший байт запиту
+  uint32_t bodyReceived;
+  uint16_t served;             // запитів на цьому з'єднанні
+  bool deferred;
+  const HttpRoute* route;
+  HttpRequest request;
+
+  char head[HTTP_HEAD_MAX];
+  uint16_t headLength;
+  char body[HTTP_BODY_MAX];
+
+  char headers[HTTP_EXTRA_HEADERS_MAX];  // додані обробником до відповіді
+  uint16_t headersLength;
+  char out[HTTP_OUT_MAX];
+  uint16_t outLength;
+  uint16_t outSent;
+  const uint8_t* payload;      // тіло з флешу без копіювання
+  uint32_t payloadLength;
+  uint32_t payloadSent;
+  HttpChunkSource source;      // тіло частинами, поки буфер вільний
+};
+
+// Неблокуючий сервер на сокетах lwIP: один select() чекає на всіх
+// з'єднаннях пулу, кожне має власний автомат розбору і буфер відповіді.
+// Повільний клієнт займає лише свій слот. Увесь виклик - з однієї задачі.
+class HttpServer {
+private:
+  uint16_t port;
+  int listenFd;
+  HttpRoute routes[HTTP_MAX_ROUTES];
+  uint8_t routeCount;
+  HttpHandler notFound;
+  HttpConnection conns[HTTP_MAX_CONNECTIONS];
+
+  uint32_t requests;
+  uint32_t rejected;
+  uint32_t reused;
+  uint32_t timeouts;
+  uint8_t peakConnections;
+  uint32_t lastResponseUs;
+  uint32_t maxResponseUs;
+  uint32_t maxHandlerUs;
+  uint32_t responseHistogram[HTTP_HISTOGRAM_BUCKETS];
+
+  void acceptClient(uint32_t now);
+  void readFrom(HttpConnection& conn, uint32_t now);
+  void parseHead(HttpConnection& conn);
+  void feedBody(HttpConnection& conn, const uint8_t* data, size_t length);
+  void dispatch(HttpConnection& conn);
+  void flush(HttpConnection& conn, uint32_t now);
+  void nextChunk(HttpConnection& conn);
+  void finishResponse(HttpConnection& conn);
+  void expire(uint32_t now);
+  void drop(HttpConnection& conn);
+  void fail(HttpConnection& conn, int code);
+  bool beginResponse(HttpConnection& conn, int code, const char* contentType, int32_t contentLength);
+  bool appendOut(HttpConnection& conn, const char* data, size_t length);
+  bool appendFormat(HttpConnection& conn, const char* format, ...);
+  HttpConnection* lookup(HttpToken token);
+  HttpToken tokenOf(const HttpConnection& conn) const;
+
+public:
+  HttpServer(uint16_t serverPort);
+
+  void on(const char* path, HttpMethod method, HttpHandler handler,
+          HttpBodyHandler bodyHandler = nullptr);
+  void onNotFound(HttpHandler handler) { notFound = handler; }
+  bool begin();
+
+  // Чекає на сокетах не довше timeoutMs і обслуговує все, що готове
+  void service(uint32_t timeoutMs);
+
+  // Відповідь на поточний або відновлений запит. Заголовки addHeader -
+  // до send(); відповідь пишеться в буфер з'єднання і йде без блокування.
+  void addHeader(HttpRequest& req, const char* name, const char* value);
+  void send(HttpRequest& req, int code, const char* contentType, const char* body, size_t length);
+  void send(HttpRequest& req, int code, const char* contentType, const char* body) {
+    send(req, code, contentType, body, strlen(body));
+  }
+  void send(HttpRequest& req, int code, const char* contentType, const String& body) {
+    send(req, code, contentType, body.c_str(), body.length());
+  }
+  void send(HttpRequest& req, int code) { send(req, code, NULL, "", 0); }
+  // Тіло відомої довжини обробник пише просто в буфер з'єднання:
+  // reserve() дає місце під length байтів і '\0', commit() відправляє.
+  // NULL - не вміщається, сервер уже відповів 500.
+  char* reserve(HttpRequest& req, int code, const char* contentType, size_t length);
+  void commit(HttpRequest& req);
+  // Тіло лишається у флеші і відправляється звідти частинами
+  void sendStatic(HttpRequest& req, int code, const char* contentType,
+                  const uint8_t* data, size_t length);
+  // Тіло невідомої довжини: source дописує в буфер з'єднання наступну
+  // частину щоразу, як попередня пішла. Відповідь - Transfer-Encoding:
+  // chunked, тож у RAM лише одна частина, а з'єднання лишається keep-alive.
+  void sendChunked(HttpRequest& req, int code, const char* contentType, HttpChunkSource source);
+
+  // Обробник повертається без відповіді, а відповідає пізніше через
+  // resume(). Хто не встиг за HTTP_DEFER_TIMEOUT_MS - отримує 504.
+  HttpToken defer(HttpRequest& req);
+  HttpRequest* resume(HttpToken token);
+
+  // Заголовки без довжини, далі з'єднання лишається відкритим для write()
+  HttpToken beginStream(HttpRequest& req, const char* contentType);
+  // false - з'єднання закрите або клієнт не встигає читати
+  bool write(HttpToken token, const char* data, size_t length);
+  bool isOpen(HttpToken token) { return lookup(token) != NULL; }
+
+  uint8_t getConnectionCount() const;
+  uint8_t getPeakConnections() const { return peakConnections; }
+  uint32_t getRequests() const { return requests; }
+  uint32_t getRejected() const { return rejected; }
+  uint32_t getReused() const { return reused; }
+  uint32_t getTimeouts() const { return timeouts; }
+  uint32_t getLastResponseUs() const { return lastResponseUs; }
+  uint32_t getMaxResponseUs() const { return maxResponseUs; }
+  uint32_t getMaxHandlerUs() const { return maxHandlerUs; }
+  uint32_t getResponseHistogram(uint8_t bucket) const { return responseHistogram[bucket]; }
+};
+
+#endif // HTTP_SERVER_H
\ No newline at end of file
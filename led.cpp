@@ -0,0 +1,79 @@
+#include "led.h"
+
+// Ефект білого світлодіода для кожного LedMode, у порядку enum
+static const LedEffect LED_MODE_EFFECTS[LED_MODE_COUNT] = {
+  {LED_EFFECT_STEADY,  LED_DUTY_MAX,  LED_FADE_MS,    0},  // LED_FORCE
+  {LED_EFFECT_STEADY,  0,             LED_FADE_MS,    0},  // LED_OFF
+  {LED_EFFECT_STEADY,  LED_DIM_LEVEL, LED_FADE_MS,    0},  // LED_DIM
+  {LED_EFFECT_BREATHE, LED_DUTY_MAX,  LED_BREATHE_MS, 0}   // LED_BREATHE
+};
+
+static const uint8_t LED_PINS[LED_CHANNEL_COUNT] = {WHITE_LED_PIN, YELLOW_LED_PIN};
+
+LedManager::LedManager(Scheduler* sched)
+  : scheduler(sched), engine(this), started(false) {
+}
+
+void LedManager::begin() {
+  if (started) return;
+  started = true;
+
+  ledc_timer_config_t timer = {};
+  timer.speed_mode = LEDC_LOW_SPEED_MODE;
+  timer.duty_resolution = (ledc_timer_bit_t)LED_PWM_BITS;
+  timer.timer_num = LEDC_TIMER_0;
+  timer.freq_hz = LED_PWM_FREQ;
+  timer.clk_cfg = LEDC_AUTO_CLK;
+  ledc_timer_config(&timer);
+
+  ledc_fade_func_install(0);
+
+  for (uint8_t i = 0; i < LED_CHANNEL_COUNT; i++) {
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = LED_PINS[i];
+    channel.speed_mode = LEDC_LOW_SPEED_MODE;
+    channel.channel = (ledc_channel_t)i;
+    channel.timer_sel = LEDC_TIMER_0;
+    channel.duty = 0;
+    channel.hpoint = 0;
+    ledc_channel_config(&channel);
+
+    ledc_cbs_t callbacks = {};
+    callbacks.fade_cb = onFadeEnd;
+    ledc_cb_register(LEDC_LOW_SPEED_MODE, (ledc_channel_t)i, &callbacks, this);
+  }
+}
+
+bool IRAM_ATTR LedManager::onFadeEnd(const ledc_cb_param_t* param, void* arg) {
+  if (param->event == LEDC_FADE_END_EVT) {
+    LedManager* self = static_cast<LedManager*>(arg);
+    self->engine.onFadeDone(param->channel);
+    self->scheduler->postFromISR(SCHED_EVENT_LED);
+  }
+  // Перемикання контексту вже зробив postFromISR
+  return false;
+}
+
+void LedManager::setMode(LedMode mode) {
+  if (mode >= LED_MODE_COUNT) mode = LED_OFF;
+  engine.play(LED_CHANNEL_WHITE, LED_MODE_EFFECTS[mode]);
+}
+
+void LedManager::setIndicator(bool on) {
+  engine.setRestLevel(LED_CHANNEL_YELLOW, on ? LED_INDICATOR_LEVEL : 0, 0);
+}
+
+void LedManager::blink(uint8_t count) {
+  LedEffect effect = {LED_EFFECT_BLINK, LED_DUTY_MAX, BUTTON_FEEDBACK_INTERVAL, count};
+  engine.play(LED_CHANNEL_YELLOW, effect);
+}
+
+void LedManager::setDuty(uint8_t channel, uint16_t duty) {
+  ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)channel, duty);
+  ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)channel);
+}
+
+void LedManager::fade(uint8_t channel, uint16_t duty, uint16_t ms) {
+  ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, (ledc_channel_t)channel, duty, ms);
+  ledc_fade_start(LEDC_LOW_SPEED_MODE, (ledc_channel_t)channel, LEDC_FADE_NO_WAIT);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef LED_H
+#define LED_H
+
+#include <Arduino.h>
+#include <driver/ledc.h>
+#include "config.h"
+#include "led_effects.h"
+#include "scheduler.h"
+
+// Бекенд рушія ефектів на LEDC: кожна фаза - апаратне згасання,
+// а процесор прокидається лише на її кінці, щоб запустити наступну.
+// Канали LEDC збігаються з LED_CHANNEL_WHITE / LED_CHANNEL_YELLOW.
+class LedManager : public LedBackend {
+private:
+  Scheduler* scheduler;
+  LedEngine engine;
+  bool started;
+
+  static bool IRAM_ATTR onFadeEnd(const ledc_cb_param_t* param, void* arg);
+
+public:
+  LedManager(Scheduler* sched);
+
+  void begin();
+
+  void setMode(LedMode mode);
+  // Жовтий світлодіод світиться, поки кнопка натиснута
+  void setIndicator(bool on);
+  void blink(uint8_t count);
+
+  // З задачі UI за SCHED_EVENT_LED
+  bool service() { return engine.service(); }
+
+  void setDuty(uint8_t channel, uint16_t duty) override;
+  void fade(uint8_t channel, uint16_t duty, uint16_t ms) override;
+};
+
+#endif // LED_H
\ No newline at end of file
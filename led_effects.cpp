@@ -0,0 +1,120 @@
+#include "led_effects.h"
+
+LedEngine::LedEngine(LedBackend* ledBackend) : backend(ledBackend) {
+  for (uint8_t i = 0; i < LED_CHANNEL_COUNT; i++) {
+    LedChannel& ch = channels[i];
+    ch.effect.type = LED_EFFECT_STEADY;
+    ch.effect.level = 0;
+    ch.effect.periodMs = 0;
+    ch.effect.count = 0;
+    ch.restLevel = 0;
+    ch.duty = 0;
+    ch.segment = 0;
+    ch.running = false;
+    ch.busy = false;
+    ch.done = false;
+  }
+}
+
+void LedEngine::play(uint8_t channel, const LedEffect& effect) {
+  LedChannel& ch = channels[channel];
+  ch.effect = effect;
+
+  // Дихання до нуля чи стрибками не має плавних фаз, на яких рушій
+  // чекав би бекенд, - це просто постійний рівень
+  if (ch.effect.type == LED_EFFECT_BREATHE &&
+      (ch.effect.level == 0 || ch.effect.periodMs == 0)) {
+    ch.effect.type = LED_EFFECT_STEADY;
+  }
+  if (ch.effect.type != LED_EFFECT_BLINK) {
+    ch.restLevel = ch.effect.level;
+  }
+
+  ch.segment = 0;
+  ch.running = true;
+  if (!ch.busy) {
+    advance(channel);
+  }
+}
+
+void LedEngine::setRestLevel(uint8_t channel, uint16_t level, uint16_t ms) {
+  LedChannel& ch = channels[channel];
+  if (ch.running && ch.effect.type == LED_EFFECT_BLINK) {
+    ch.restLevel = level;
+    return;
+  }
+
+  LedEffect steady = {LED_EFFECT_STEADY, level, ms, 0};
+  play(channel, steady);
+}
+
+bool LedEngine::nextSegment(const LedChannel& ch, uint16_t& target, uint16_t& ms) const {
+  const LedEffect& e = ch.effect;
+  ms = e.periodMs;
+
+  switch (e.type) {
+    case LED_EFFECT_STEADY:
+      target = e.level;
+      return ch.segment == 0;
+
+    case LED_EFFECT_BREATHE:
+      // Лічильник фаз може переповнитись - парність при цьому зберігається
+      target = (ch.segment & 1) ? 0 : e.level;
+      return true;
+
+    case LED_EFFECT_BLINK: {
+      uint16_t phases = (uint16_t)e.count * 2;
+      if (ch.segment < phases) {
+        target = (ch.segment & 1) ? 0 : e.level;
+        return true;
+      }
+      target = ch.restLevel;
+      ms = 0;
+      return ch.segment == phases;
+    }
+  }
+  return false;
+}
+
+void LedEngine::advance(uint8_t channel) {
+  LedChannel& ch = channels[channel];
+
+  while (ch.running) {
+    uint16_t target;
+    uint16_t ms;
+    if (!nextSegment(ch, target, ms)) {
+      ch.running = false;
+      break;
+    }
+    ch.segment++;
+
+    // Фаза без зміни шпаровності не дасть події від бекенда
+    if (target == ch.duty) continue;
+    ch.duty = target;
+
+    if (ms == 0) {
+      backend->setDuty(channel, target);
+      continue;
+    }
+
+    ch.busy = true;
+    backend->fade(channel, target, ms);
+    break;
+  }
+}
+
+bool LedEngine::service() {
+  bool active = false;
+
+  for (uint8_t i = 0; i < LED_CHANNEL_COUNT; i++) {
+    LedChannel& ch = channels[i];
+    if (ch.done) {
+      ch.done = false;
+      ch.busy = false;
+      advance(i);
+    }
+    active = active || ch.running || ch.busy;
+  }
+
+  return active;
+}
\ No newline at end of file
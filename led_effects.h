@@ -0,0 +1,77 @@
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= ЕФЕКТИ СВІТЛОДІОДІВ =============
+// Ефект - це послідовність фаз "довести шпаровність до X за T мс".
+// Фазу виконує бекенд (апаратні згасання LEDC), рушій лише вибирає
+// наступну, коли попередня закінчилась. Не залежить від Arduino,
+// тому на ПК рушій можна ганяти з макетом бекенда.
+
+#define LED_CHANNEL_WHITE  0
+#define LED_CHANNEL_YELLOW 1
+#define LED_CHANNEL_COUNT  2
+
+enum LedEffectType : uint8_t {
+  LED_EFFECT_STEADY,   // перейти до level і лишитись
+  LED_EFFECT_BREATHE,  // level -> 0 -> level ... без кінця
+  LED_EFFECT_BLINK     // count спалахів, потім назад до рівня спокою
+};
+
+struct LedEffect {
+  LedEffectType type;
+  uint16_t level;     // шпаровність, 0..LED_DUTY_MAX
+  uint16_t periodMs;  // тривалість однієї фази; 0 - стрибком
+  uint8_t count;      // кількість спалахів для LED_EFFECT_BLINK
+};
+
+class LedBackend {
+public:
+  virtual ~LedBackend() {}
+  // Одразу виставити шпаровність
+  virtual void setDuty(uint8_t channel, uint16_t duty) = 0;
+  // Почати плавний перехід; по завершенні бекенд викликає
+  // LedEngine::onFadeDone(channel), можна з переривання
+  virtual void fade(uint8_t channel, uint16_t duty, uint16_t ms) = 0;
+};
+
+struct LedChannel {
+  LedEffect effect;
+  uint16_t restLevel;  // куди повертається канал після спалахів
+  uint16_t duty;       // ціль останньої фази
+  uint8_t segment;
+  bool running;        // у ефекту ще є фази
+  bool busy;           // бекенд виконує фазу
+  volatile bool done;  // фаза завершилась; ставиться з переривання
+};
+
+class LedEngine {
+private:
+  LedBackend* backend;
+  LedChannel channels[LED_CHANNEL_COUNT];
+
+  bool nextSegment(const LedChannel& ch, uint16_t& target, uint16_t& ms) const;
+  void advance(uint8_t channel);
+
+public:
+  LedEngine(LedBackend* ledBackend);
+
+  // Новий ефект на каналі. Фаза, що вже йде в бекенді, не
+  // переривається - ефект почнеться з її кінцем.
+  void play(uint8_t channel, const LedEffect& effect);
+  // Рівень спокою: під час спалахів лише запам'ятовується
+  void setRestLevel(uint8_t channel, uint16_t level, uint16_t ms);
+
+  void onFadeDone(uint8_t channel) { channels[channel].done = true; }
+
+  // Запускає наступні фази після onFadeDone(). Повертає true,
+  // поки хоч один ефект ще не закінчився.
+  bool service();
+
+  uint16_t getDuty(uint8_t channel) const { return channels[channel].duty; }
+  bool isRunning(uint8_t channel) const { return channels[channel].running || channels[channel].busy; }
+};
+
+#endif // LED_EFFECTS_H
\ No newline at end of file
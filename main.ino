@@ -4,139 +4,323 @@
 #include <time.h>
 
 #include "config.h"
+#include "scheduler.h"
+#include "messages.h"
 #include "storage.h"
 #include "alarm.h"
+#include "ringtone.h"
 #include "weather.h"
+#include "sensor.h"
+#include "button.h"
+#include "led.h"
 #include "display.h"
 #include "wifi_manager.h"
 
 // ============= ГЛОБАЛЬНІ ОБ'ЄКТИ =============
-Storage storage;
-AlarmManager alarmManager;
+Scheduler scheduler;
+Storage storage(&scheduler);
+AlarmManager alarmManager(&storage);
+RingtoneStore ringtones;
+HistoryStore history;
 WeatherManager weatherManager;
 
 // NTP
 WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, NTP_SERVER, GMT_OFFSET_SEC, NTP_UPDATE_INTERVAL);
+NTPClient timeClient(ntpUDP, NTP_SERVER, 0, NTP_UPDATE_INTERVAL);  // UTC, пояс - у TZ_STRING
+
+// Черги між задачами: мережа -> UI, UI -> мережа, датчик -> UI
+UiQueue uiQueue;
+NetQueue netQueue;
+SensorQueue sensorQueue;
 
 // Датчик
 Adafruit_BMP280 bmp;
+SensorManager sensorManager(&bmp, &sensorQueue, &scheduler, &history);
+float latestPressure = NAN;
+float latestTemperature = NAN;
 
 // Дисплей
 LGFX tft;
 LGFX_Sprite sprite(&tft);
+LGFX_Sprite backSprite(&tft);
 Screen currentScreen = SCREEN_TIME;
-DisplayManager displayManager(&tft, &sprite, &bmp, &currentScreen);
+DisplayManager displayManager(&tft, &sprite, &backSprite, &currentScreen);
+
+// WiFi і веб-сервер; живе у власній задачі, стан UI змінює лише повідомленнями
+WiFiManager wifiManager(&storage, &alarmManager, &weatherManager, &ringtones, &displayManager,
+                        &history, &scheduler, &uiQueue, &netQueue);
 
-// WiFi і веб-сервер
+// Екран налаштувань треба перемалювати; лише для задачі UI
 bool needUpdateSetScreen = false;
-WiFiManager wifiManager(&storage, &alarmManager, &weatherManager, &currentScreen, &needUpdateSetScreen);
+// Графік тиску вже заповнено з журналу; лише для задачі UI
+bool pressureHistoryLoaded = false;
 
 // ============= УПРАВЛІННЯ СВІТЛОДІОДАМИ =============
+// Ефекти крутить LEDC; задача UI лише запускає наступну фазу
 LedMode ledMode = LED_OFF;
+LedManager ledManager(&scheduler);
+
+// ============= УПРАВЛІННЯ КНОПКОЮ =============
+// Жести розбирає ButtonManager у перериванні й таймерах esp_timer,
+// задача UI лише виконує дії
+ButtonQueue buttonQueue;
+ButtonManager buttonManager(BUTTON_PIN, &buttonQueue, &scheduler);
+
+void switchScreen(Screen screen, Transition effect, int64_t edgeUs) {
+  currentScreen = screen;
+  displayManager.markInput(edgeUs);
+  displayManager.showScreen(effect);
+  scheduler.post(SCHED_EVENT_REDRAW);
+
+  NetMessage screenMsg = {NET_MSG_SCREEN, (uint8_t)currentScreen};
+  netQueue.push(screenMsg);
+
+  switch (currentScreen) {
+    case SCREEN_TIME:
+      updateTimeClient();
+      displayManager.updateTimeScreen(timeClient);
+      break;
 
-void controlLED() {
-  switch (ledMode) {
-    case LED_FORCE:
-      digitalWrite(WHITE_LED_PIN, HIGH);
+    case SCREEN_NATURE:
+      displayManager.updateNatureScreen(weatherManager, latestPressure, latestTemperature);
       break;
-    case LED_OFF:
-      digitalWrite(WHITE_LED_PIN, LOW);
+
+    case SCREEN_SETTINGS:
+      displayManager.updateSettingsScreen(
+        alarmManager.getHour(),
+        alarmManager.getMinute(),
+        alarmManager.isEnabled(),
+        alarmManager.isTriggered()
+      );
       break;
   }
 }
 
-// ============= УПРАВЛІННЯ КНОПКОЮ =============
-unsigned long buttonPressStart = 0;
-unsigned long lastDebounceTime = 0;
-bool longPressHandled = false;
-int lastButtonState = HIGH;
-int buttonState = HIGH;
-
-void handleButtonPress() {
-  int reading = digitalRead(BUTTON_PIN);
-
-  if (reading == LOW && lastButtonState == HIGH) {
-    buttonPressStart = millis();
-    longPressHandled = false;
+void cycleLedMode() {
+  ledMode = (LedMode)((ledMode + 1) % LED_MODE_COUNT);
+  storage.saveLEDMode(ledMode);
+  ledManager.setMode(ledMode);
+
+  if (currentScreen == SCREEN_SETTINGS) {
+    needUpdateSetScreen = true;
   }
- 
-  if (reading == LOW && !longPressHandled) {
-    if (millis() - buttonPressStart >= BUTTON_LONG_PRESS_TIME) {
-      // Довге натискання - зміна режиму LED
-      ledMode = (LedMode)((ledMode + 1) % 2);
-      longPressHandled = true;
-      storage.saveLEDMode(ledMode);
-     
-      if (currentScreen == SCREEN_SETTINGS) {
+
+  // Мигання жовтим LED - апаратними згасаннями, без delay()
+  ledManager.blink(BUTTON_FEEDBACK_BLINKS);
+}
+
+void handleButtonEvent(const ButtonEvent& event) {
+  switch (event.type) {
+    case BUTTON_EVENT_DOWN:
+    case BUTTON_EVENT_UP:
+      ledManager.setIndicator(event.type == BUTTON_EVENT_DOWN);
+      break;
+
+    case BUTTON_EVENT_SHORT:
+      if (alarmManager.isRinging()) {
+        // Коротке натискання під час дзвінка - повтор через кілька хвилин
+        alarmManager.snooze();
         needUpdateSetScreen = true;
+        break;
       }
-     
-      // Мигання жовтим LED
-      for (int i = 0; i < 3; i++) {
-        digitalWrite(YELLOW_LED_PIN, HIGH);
-        delay(100);
-        digitalWrite(YELLOW_LED_PIN, LOW);
-        delay(100);
+      // Наступний екран; повернення на перший - згасання, решта - зсув уліво
+      {
+        Screen next = (Screen)((currentScreen + 1) % SCREEN_COUNT);
+        switchScreen(next, next == SCREEN_TIME ? TRANSITION_FADE : TRANSITION_SLIDE_LEFT,
+                     event.edgeUs);
       }
-    }
+      break;
+
+    case BUTTON_EVENT_DOUBLE:
+      if (alarmManager.isTriggered()) {
+        // Подвійний - вимкнути зовсім, і відкладений теж
+        alarmManager.stopRinging();
+        needUpdateSetScreen = true;
+        break;
+      }
+      // Подвійний клік - додому, на екран часу
+      if (currentScreen != SCREEN_TIME) {
+        switchScreen(SCREEN_TIME, TRANSITION_SLIDE_RIGHT, event.edgeUs);
+      }
+      break;
+
+    case BUTTON_EVENT_LONG:
+    case BUTTON_EVENT_REPEAT:
+      // Довге натискання - наступний режим LED; утримання гортає далі
+      cycleLedMode();
+      break;
   }
+}
+
+// ============= ЧАС =============
+// NTPClient рахує секунди від моменту останньої синхронізації,
+// тож межа секунди зсунута відносно millis() на фазу цього моменту
+unsigned long secondPhase = 0;
+
+void updateTimeClient() {
+  // Офлайн запит NTP лише блокував би UI до тайм-ауту;
+  // годинник іде від millis() і без синхронізації
+  if (!wifiManager.isConnected()) return;
 
-  if (reading != lastButtonState) {
-    lastDebounceTime = millis();
+  if (timeClient.update()) {
+    secondPhase = millis() % 1000;
   }
+}
+
+uint32_t msToNextSecond() {
+  uint32_t intoSecond = (millis() + 1000 - secondPhase) % 1000;
+  return 1000 - intoSecond + SECOND_MARGIN_MS;
+}
+
+// ============= ЗАДАЧІ ПЛАНУВАЛЬНИКА =============
+uint32_t buttonJob() {
+  ButtonEvent event;
+  while (buttonQueue.pop(event)) {
+    handleButtonEvent(event);
+  }
+  return SCHEDULER_IDLE;
+}
+
+uint32_t ledJob() {
+  ledManager.service();
+  return SCHEDULER_IDLE;
+}
 
-  if ((millis() - lastDebounceTime) > BUTTON_DEBOUNCE_DELAY) {
-    if (reading != buttonState) {
-      buttonState = reading;
-
-      if (buttonState == HIGH && !longPressHandled) {
-        if (millis() - buttonPressStart < BUTTON_LONG_PRESS_TIME) {
-          // Коротке натискання - зміна екрану
-          currentScreen = (Screen)((currentScreen + 1) % SCREEN_COUNT);
-          displayManager.clearScreenArea();
-          displayManager.displayHeader();
-
-          switch (currentScreen) {
-            case SCREEN_TIME:
-              timeClient.update();
-              displayManager.updateTimeScreen(timeClient);
-              break;
-              
-            case SCREEN_NATURE:
-              displayManager.resetCache();
-              if (!weatherManager.hasData()) {
-                tft.setTextSize(2);
-                tft.setTextColor(TFT_GREEN);
-                tft.setCursor(0, 90);
-                tft.print("Waiting for");
-                tft.setCursor(0, 120);
-                tft.print("weather data");
-              }
-              displayManager.updateNatureScreen(weatherManager);
-              break;
-              
-            case SCREEN_SETTINGS:
-              displayManager.resetCache();
-              displayManager.updateSettingsScreen(
-                alarmManager.getHour(),
-                alarmManager.getMinute(),
-                alarmManager.isEnabled(),
-                alarmManager.isTriggered()
-              );
-              break;
-          }
-        }
+uint32_t displayJob() {
+  displayManager.tick();
+  // Темп кадрів тримає сам tick(), тут лише часто перевіряємо
+  return displayManager.isTransitionActive() ? SCHEDULER_TICK_MS : SCHEDULER_IDLE;
+}
+
+uint32_t clockJob() {
+  // Обриви WiFi обробляє задача "net" - годинник і будильник працюють далі
+  updateTimeClient();
+  alarmManager.checkAlarm(time(NULL));
+
+  switch (currentScreen) {
+    case SCREEN_TIME:
+      displayManager.updateTimeScreen(timeClient);
+      break;
+
+    case SCREEN_NATURE:
+      displayManager.updateNatureScreen(weatherManager, latestPressure, latestTemperature);
+      break;
+
+    case SCREEN_SETTINGS:
+      if (needUpdateSetScreen) {
+        displayManager.updateSettingsScreen(
+          alarmManager.getHour(),
+          alarmManager.getMinute(),
+          alarmManager.isEnabled(),
+          alarmManager.isTriggered()
+        );
+        needUpdateSetScreen = false;
       }
-    }
+      break;
   }
 
-  lastButtonState = reading;
-  digitalWrite(YELLOW_LED_PIN, (reading == LOW) ? HIGH : LOW);
+  return msToNextSecond();
+}
+
+uint32_t weatherJob() {
+  // Публікація готових даних і автоматичне оновлення погоди
+  weatherManager.update();
+  return weatherManager.msUntilDue();
 }
 
-// ============= ТАЙМЕРИ =============
-unsigned long lastTimeUpdate = 0;
+uint32_t storageJob() {
+  // Відкладений запис налаштувань, коли зміни стихли
+  return storage.service();
+}
+
+void handleUiMessage(const UiMessage& msg) {
+  switch (msg.type) {
+    // Будильник сам зберігає список через storage
+    case UI_MSG_ALARM_ADD:
+      alarmManager.addAlarm(msg.id, msg.hour, msg.minute, msg.days, msg.enabled);
+      needUpdateSetScreen = true;
+      break;
+
+    case UI_MSG_ALARM_DELETE:
+      alarmManager.removeAlarm(msg.id);
+      needUpdateSetScreen = true;
+      break;
+
+    case UI_MSG_ALARM_UPDATE:
+      alarmManager.updateAlarm(msg.id, msg.enabled, msg.skip);
+      needUpdateSetScreen = true;
+      break;
+
+    case UI_MSG_ALARM_SNOOZE:
+      alarmManager.snooze();
+      needUpdateSetScreen = true;
+      break;
+
+    case UI_MSG_ALARM_STOP:
+      alarmManager.stopRinging();
+      needUpdateSetScreen = true;
+      break;
+
+    case UI_MSG_WEATHER_KEY: {
+      String apiKey = msg.text;
+      weatherManager.setApiKey(apiKey);
+      storage.saveWeatherApiKey(apiKey);
+      if (apiKey.length() > 0) {
+        weatherManager.requestUpdate();
+      }
+      break;
+    }
+
+    case UI_MSG_WEATHER_REFRESH:
+      weatherManager.requestUpdate();
+      break;
+
+    case UI_MSG_REDRAW:
+      needUpdateSetScreen = true;
+      break;
+  }
+}
+
+uint32_t messageJob() {
+  UiMessage msg;
+  while (uiQueue.pop(msg)) {
+    handleUiMessage(msg);
+  }
+
+  // Для дисплея потрібна лише найсвіжіша вибірка
+  SensorSample sample;
+  bool sampled = false;
+  while (sensorQueue.pop(sample)) {
+    latestPressure = sample.pressurePa;
+    latestTemperature = sample.temperature;
+    sampled = true;
+  }
+  if (sampled) {
+    // SNTP синхронізується асинхронно, тож журнал читаємо з першою вибіркою,
+    // що бачить справжній час, - до неї addPressureSample() вибірки відкидає
+    if (!pressureHistoryLoaded) {
+      pressureHistoryLoaded = displayManager.loadPressureHistory(&history);
+    }
+    displayManager.addPressureSample(time(NULL), sample.pressurePa);
+
+    // Для потоку подій веб-панелі; якщо черга повна, піде наступна вибірка
+    NetMessage sensorMsg = {NET_MSG_SENSOR, 0, sample.pressurePa, sample.temperature};
+    netQueue.push(sensorMsg);
+  }
+
+  // Зміни налаштувань видно одразу, а не з наступною секундою
+  if (needUpdateSetScreen && currentScreen == SCREEN_SETTINGS) {
+    displayManager.updateSettingsScreen(
+      alarmManager.getHour(),
+      alarmManager.getMinute(),
+      alarmManager.isEnabled(),
+      alarmManager.isTriggered()
+    );
+    needUpdateSetScreen = false;
+  }
+
+  return SCHEDULER_IDLE;
+}
 
 // ============= SETUP =============
 void setup() {
@@ -145,23 +329,20 @@ void setup() {
 
   // Ініціалізація Storage
   storage.begin();
+  ringtones.begin();
+  history.begin();
 
   // Завантаження налаштувань
   String savedSSID = storage.loadSSID();
-  String savedPassword = storage.loadPassword();
-  int hour, minute;
-  bool enabled;
-  storage.loadAlarmSettings(hour, minute, enabled);
-  alarmManager.setTime(hour, minute);
-  alarmManager.setEnabled(enabled);
+  alarmManager.begin();
   ledMode = storage.loadLEDMode();
   String apiKey = storage.loadWeatherApiKey();
   weatherManager.setApiKey(apiKey);
 
   // Спроба підключення до WiFi
   displayManager.intro(savedSSID);
-  if (savedSSID.length() > 0) {
-    wifiManager.connectToWiFi(savedSSID, savedPassword);
+  if (wifiManager.connectToWiFi()) {
+    wifiManager.waitForConnection(WIFI_BOOT_TIMEOUT_MS);
   }
 
   // Якщо не підключились, запускаємо AP
@@ -177,19 +358,20 @@ void setup() {
     }
 
     // Якщо підключились через веб-панель, перезапускаємо
+    storage.flush();
     ESP.restart();
   }
 
   // Ініціалізація периферії
   timeClient.begin();
   bmp.begin(0x76);
-  pinMode(BUTTON_PIN, INPUT_PULLUP);
-  pinMode(YELLOW_LED_PIN, OUTPUT);
-  pinMode(WHITE_LED_PIN, OUTPUT);
+  sensorManager.begin();
+  ledManager.begin();
+  ledManager.setMode(ledMode);
   alarmManager.setupI2S();
 
-  // Налаштування NTP
-  configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
+  // Налаштування NTP; правило поясу потрібне localtime_r() і розкладу будильників
+  configTzTime(TZ_STRING, NTP_SERVER);
 
   // Очікування синхронізації NTP
   int syncAttempts = 0;
@@ -203,65 +385,37 @@ void setup() {
     timeClient.forceUpdate();
     delay(1000);
   }
+  secondPhase = millis() % 1000;
 
-  // Перше оновлення погоди
-  if (weatherManager.hasApiKey()) {
-    weatherManager.fetchWeatherData();
-  }
+  // Фонова задача погоди; перший запит піде з першим проходом loop()
+  weatherManager.begin(&scheduler);
 
   // Налаштування веб-сервера
   wifiManager.begin();
 
   // Відображення початкового екрану
-  displayManager.displayHeader();
+  displayManager.showScreen();
   displayManager.updateTimeScreen(timeClient);
-}
 
-// ============= LOOP =============
-void loop() {
-  wifiManager.handleClient();
+  // Планувальник живе в задачі loop(), її й будять переривання
+  scheduler.begin();
+  buttonManager.begin();
 
-  if (wifiManager.isConnected()) {
-    unsigned long now = millis();
+  scheduler.add("button", buttonJob, 4, SCHED_EVENT_BUTTON, SCHEDULER_IDLE);
+  scheduler.add("display", displayJob, 3, SCHED_EVENT_REDRAW, SCHEDULER_IDLE);
+  scheduler.add("clock", clockJob, 2, 0, msToNextSecond());
+  scheduler.add("led", ledJob, 1, SCHED_EVENT_LED, SCHEDULER_IDLE);
+  scheduler.add("messages", messageJob, 2, SCHED_EVENT_MESSAGE, 0);
+  scheduler.add("weather", weatherJob, 1, SCHED_EVENT_WEATHER, 0);
+  scheduler.add("storage", storageJob, 0, SCHED_EVENT_STORAGE, SCHEDULER_IDLE);
 
-    // Автоматичне оновлення погоди
-    if (weatherManager.shouldUpdate()) {
-      weatherManager.fetchWeatherData();
-    }
+  // Сервер - у задачі "net"; loop() лишається задачею UI
+  wifiManager.startTask();
+}
 
-    controlLED();
-    handleButtonPress();
-
-    // Оновлення дисплея
-    if (now - lastTimeUpdate >= TIME_UPDATE_INTERVAL) {
-      timeClient.update();
-      alarmManager.checkAlarm(timeClient);
-     
-      switch (currentScreen) {
-        case SCREEN_TIME:
-          displayManager.updateTimeScreen(timeClient);
-          break;
-          
-        case SCREEN_NATURE:
-          displayManager.updateNatureScreen(weatherManager);
-          break;
-          
-        case SCREEN_SETTINGS:
-          if (needUpdateSetScreen) {
-            displayManager.updateSettingsScreen(
-              alarmManager.getHour(),
-              alarmManager.getMinute(),
-              alarmManager.isEnabled(),
-              alarmManager.isTriggered()
-            );
-            needUpdateSetScreen = false;
-          }
-          break;
-      }
-      lastTimeUpdate = now;
-    }
-  } else {
-    // Якщо втратили з'єднання, перезапускаємо
-    ESP.restart();
-  }
+// ============= LOOP =============
+void loop() {
+  // Задача UI: виконує задачі планувальника, чий час настав,
+  // і спить до наступного дедлайну чи події
+  scheduler.run();
 }
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef MESSAGES_H
+#define MESSAGES_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "spsc_queue.h"
+#include "sensor_filter.h"
+
+// ============= МЕРЕЖА -> UI =============
+// Веб-обробники не чіпають стан UI напряму, а просять задачу UI
+enum UiMessageType : uint8_t {
+  UI_MSG_ALARM_ADD,       // id (зарезервований), hour, minute, days, enabled
+  UI_MSG_ALARM_DELETE,    // id
+  UI_MSG_ALARM_UPDATE,    // id, enabled, skip
+  UI_MSG_ALARM_SNOOZE,
+  UI_MSG_ALARM_STOP,
+  UI_MSG_WEATHER_KEY,     // text - новий API ключ
+  UI_MSG_WEATHER_REFRESH,
+  UI_MSG_REDRAW           // перемалювати поточний екран
+};
+
+struct UiMessage {
+  UiMessageType type;
+  uint8_t id;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t days;
+  bool enabled;
+  bool skip;
+  char text[WEATHER_KEY_MAX];
+};
+
+// ============= UI -> МЕРЕЖА =============
+enum NetMessageType : uint8_t {
+  NET_MSG_SCREEN,         // screen - екран, який зараз показано
+  NET_MSG_SENSOR          // pressurePa, temperature - остання вибірка датчика
+};
+
+struct NetMessage {
+  NetMessageType type;
+  uint8_t screen;
+  float pressurePa;
+  float temperature;
+};
+
+typedef SpscQueue<UiMessage, UI_QUEUE_LENGTH> UiQueue;
+typedef SpscQueue<NetMessage, NET_QUEUE_LENGTH> NetQueue;
+typedef SpscQueue<SensorSample, SENSOR_QUEUE_LENGTH> SensorQueue;
+
+#endif // MESSAGES_H
\ No newline at end of file
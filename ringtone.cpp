@@ -0,0 +1,206 @@
+#include "ringtone.h"
+
+static const char RINGTONE_MAGIC[4] = {'R', 'T', 'N', '1'};
+
+static bool readHeader(File& file, RingtoneHeader& header) {
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  return memcmp(header.magic, RINGTONE_MAGIC, sizeof(RINGTONE_MAGIC)) == 0 &&
+         header.sampleRate == I2S_SAMPLE_RATE &&
+         header.blockSamples == I2S_DMA_BUF_LEN;
+}
+
+// ============= RINGTONE STORE =============
+RingtoneStore::RingtoneStore()
+  : pcmCount(0), oddByte(0), hasOddByte(false),
+    uploadSamples(0), uploading(false), mounted(false) {
+  adpcmReset(encoder);
+}
+
+bool RingtoneStore::begin() {
+  // Форматуємо розділ при першому запуску
+  mounted = LittleFS.begin(true);
+  return mounted;
+}
+
+bool RingtoneStore::exists() {
+  return mounted && LittleFS.exists(RINGTONE_PATH);
+}
+
+bool RingtoneStore::remove() {
+  return exists() && LittleFS.remove(RINGTONE_PATH);
+}
+
+uint32_t RingtoneStore::getDurationMs() {
+  if (!exists()) return 0;
+
+  File file = LittleFS.open(RINGTONE_PATH, "r");
+  RingtoneHeader header;
+  bool valid = file && readHeader(file, header);
+  file.close();
+
+  return valid ? (uint32_t)((uint64_t)header.sampleCount * 1000 / I2S_SAMPLE_RATE) : 0;
+}
+
+bool RingtoneStore::beginUpload() {
+  if (!mounted) return false;
+  if (uploading) abortUpload();
+
+  uploadFile = LittleFS.open(RINGTONE_UPLOAD_PATH, "w");
+  if (!uploadFile) return false;
+
+  // Місце під заголовок, кількість семплів допишемо наприкінці
+  RingtoneHeader header = {};
+  uploadFile.write((const uint8_t*)&header, sizeof(header));
+
+  adpcmReset(encoder);
+  pcmCount = 0;
+  hasOddByte = false;
+  uploadSamples = 0;
+  uploading = true;
+  return true;
+}
+
+bool RingtoneStore::writeBlock() {
+  uint8_t packed[RINGTONE_BLOCK_BYTES];
+  RingtoneBlockHeader* blockHeader = (RingtoneBlockHeader*)packed;
+
+  // Доповнюємо неповний останній блок тишею
+  for (size_t i = pcmCount; i < I2S_DMA_BUF_LEN; i++) {
+    pcm[i] = 0;
+  }
+
+  blockHeader->predictor = encoder.predictor;
+  blockHeader->index = encoder.index;
+  blockHeader->reserved = 0;
+  adpcmEncode(encoder, pcm, I2S_DMA_BUF_LEN, packed + sizeof(RingtoneBlockHeader));
+
+  uploadSamples += pcmCount;
+  pcmCount = 0;
+  return uploadFile.write(packed, sizeof(packed)) == sizeof(packed);
+}
+
+bool RingtoneStore::appendPcm(const uint8_t* data, size_t len) {
+  if (!uploading) return false;
+
+  const uint32_t maxSamples = (uint32_t)I2S_SAMPLE_RATE * RINGTONE_MAX_SECONDS;
+
+  for (size_t i = 0; i < len; i++) {
+    // Семпл може розірватися між двома чанками HTTP
+    if (!hasOddByte) {
+      oddByte = data[i];
+      hasOddByte = true;
+      continue;
+    }
+    hasOddByte = false;
+
+    if (uploadSamples + pcmCount >= maxSamples) {
+      return true;  // Все, що довше ліміту, відкидаємо
+    }
+
+    pcm[pcmCount++] = (int16_t)(oddByte | (data[i] << 8));
+    if (pcmCount == I2S_DMA_BUF_LEN && !writeBlock()) {
+      abortUpload();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool RingtoneStore::finishUpload() {
+  if (!uploading) return false;
+
+  if (pcmCount > 0 && !writeBlock()) {
+    abortUpload();
+    return false;
+  }
+
+  if (uploadSamples == 0) {
+    abortUpload();
+    return false;
+  }
+
+  RingtoneHeader header;
+  memcpy(header.magic, RINGTONE_MAGIC, sizeof(RINGTONE_MAGIC));
+  header.sampleRate = I2S_SAMPLE_RATE;
+  header.sampleCount = uploadSamples;
+  header.blockSamples = I2S_DMA_BUF_LEN;
+  header.reserved = 0;
+
+  uploadFile.seek(0);
+  uploadFile.write((const uint8_t*)&header, sizeof(header));
+  uploadFile.close();
+  uploading = false;
+
+  LittleFS.remove(RINGTONE_PATH);
+  return LittleFS.rename(RINGTONE_UPLOAD_PATH, RINGTONE_PATH);
+}
+
+void RingtoneStore::abortUpload() {
+  if (uploadFile) {
+    uploadFile.close();
+  }
+  uploading = false;
+  LittleFS.remove(RINGTONE_UPLOAD_PATH);
+}
+
+// ============= RINGTONE READER =============
+RingtoneReader::RingtoneReader() : samplesLeft(0), totalSamples(0) {
+}
+
+bool RingtoneReader::open() {
+  close();
+
+  if (!LittleFS.exists(RINGTONE_PATH)) return false;
+
+  file = LittleFS.open(RINGTONE_PATH, "r");
+  RingtoneHeader header;
+  if (!file || !readHeader(file, header) || header.sampleCount == 0) {
+    close();
+    return false;
+  }
+
+  totalSamples = header.sampleCount;
+  samplesLeft = totalSamples;
+  return true;
+}
+
+void RingtoneReader::close() {
+  if (file) {
+    file.close();
+  }
+  samplesLeft = 0;
+  totalSamples = 0;
+}
+
+bool RingtoneReader::rewind() {
+  if (!isOpen() || !file.seek(sizeof(RingtoneHeader))) return false;
+
+  samplesLeft = totalSamples;
+  return true;
+}
+
+size_t RingtoneReader::readBlock(int16_t* out) {
+  if (samplesLeft == 0) return 0;
+
+  if (file.read(packed, sizeof(packed)) != sizeof(packed)) {
+    samplesLeft = 0;
+    return 0;
+  }
+
+  const RingtoneBlockHeader* blockHeader = (const RingtoneBlockHeader*)packed;
+  AdpcmState state = {blockHeader->predictor, blockHeader->index};
+  if (state.index > 88) {
+    state.index = 88;  // Захист від пошкодженого файлу
+  }
+  adpcmDecode(state, packed + sizeof(RingtoneBlockHeader), I2S_DMA_BUF_LEN, out);
+
+  size_t samples = samplesLeft < I2S_DMA_BUF_LEN ? samplesLeft : I2S_DMA_BUF_LEN;
+  for (size_t i = samples; i < I2S_DMA_BUF_LEN; i++) {
+    out[i] = 0;
+  }
+  samplesLeft -= samples;
+  return samples;
+}
\ No newline at end of file
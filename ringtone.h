@@ -0,0 +1,79 @@
+#ifndef RINGTONE_H
+#define RINGTONE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "adpcm.h"
+
+// ============= ФОРМАТ ФАЙЛУ =============
+// Заголовок, далі блоки по I2S_DMA_BUF_LEN семплів:
+// стан ADPCM на початку блоку + упаковані нібли.
+// Кожен блок декодується окремо, тож у RAM живе лише один блок.
+struct RingtoneHeader {
+  char magic[4];
+  uint32_t sampleRate;
+  uint32_t sampleCount;
+  uint16_t blockSamples;
+  uint16_t reserved;
+};
+
+struct RingtoneBlockHeader {
+  int16_t predictor;
+  uint8_t index;
+  uint8_t reserved;
+};
+
+#define RINGTONE_BLOCK_BYTES (sizeof(RingtoneBlockHeader) + (I2S_DMA_BUF_LEN + 1) / 2)
+
+// Приймає сирий PCM16 з веб-панелі і стискає його на льоту
+class RingtoneStore {
+private:
+  File uploadFile;
+  AdpcmState encoder;
+  int16_t pcm[I2S_DMA_BUF_LEN];
+  size_t pcmCount;
+  uint8_t oddByte;
+  bool hasOddByte;
+  uint32_t uploadSamples;
+  bool uploading;
+  bool mounted;
+
+  bool writeBlock();
+
+public:
+  RingtoneStore();
+
+  bool begin();
+  bool exists();
+  bool remove();
+  uint32_t getDurationMs();
+
+  bool beginUpload();
+  bool appendPcm(const uint8_t* data, size_t len);
+  bool finishUpload();
+  void abortUpload();
+};
+
+// Потокове читання: один блок за виклик
+class RingtoneReader {
+private:
+  File file;
+  uint32_t samplesLeft;
+  uint32_t totalSamples;
+  uint8_t packed[RINGTONE_BLOCK_BYTES];
+
+public:
+  RingtoneReader();
+
+  bool open();
+  void close();
+  bool rewind();
+  bool isOpen() const { return totalSamples > 0; }
+
+  // Декодує наступний блок у out, решту заповнює нулями.
+  // Повертає 0 наприкінці кліпу.
+  size_t readBlock(int16_t* out);
+};
+
+#endif // RINGTONE_H
\ No newline at end of file
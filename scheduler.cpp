@@ -0,0 +1,237 @@
+#include "scheduler.h"
+
+Scheduler::Scheduler()
+  : jobCount(0), currentTick(0), tickCount(0), tickBaseMs(0), pendingEvents(0), owner(NULL),
+    statsStart(0), sleepMicros(0), idlePermille(0) {
+  for (uint8_t i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+    wheel[i] = -1;
+  }
+  for (uint8_t i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+    eventMicros[i] = 0;
+  }
+}
+
+void Scheduler::begin() {
+  owner = xTaskGetCurrentTaskHandle();
+  currentTick = nowTick();
+  statsStart = micros();
+}
+
+uint32_t Scheduler::nowTick() {
+  uint32_t ticks = (millis() - tickBaseMs) / SCHEDULER_TICK_MS;
+  tickCount += ticks;
+  tickBaseMs += ticks * SCHEDULER_TICK_MS;
+  return tickCount;
+}
+
+int Scheduler::add(const char* name, SchedulerCallback callback, uint8_t priority,
+                   uint32_t events, uint32_t firstDelayMs) {
+  if (jobCount >= SCHEDULER_MAX_JOBS) return -1;
+
+  uint8_t id = jobCount++;
+  SchedulerJob& job = jobs[id];
+  job.name = name;
+  job.callback = callback;
+  job.priority = priority;
+  job.events = events;
+  job.deadlineTick = 0;
+  job.readyMicros = 0;
+  job.next = -1;
+  job.armed = false;
+  job.ready = false;
+  job.runs = 0;
+  job.lastLatencyUs = 0;
+  job.maxLatencyUs = 0;
+  job.maxRunUs = 0;
+
+  arm(id, firstDelayMs);
+  return id;
+}
+
+void Scheduler::arm(uint8_t id, uint32_t delayMs) {
+  if (delayMs == SCHEDULER_IDLE) return;
+
+  // Дедлайн округлюється вгору до тіку, але не раніше наступного
+  SchedulerJob& job = jobs[id];
+  uint32_t ticks = (delayMs + SCHEDULER_TICK_MS - 1) / SCHEDULER_TICK_MS;
+  job.deadlineTick = nowTick() + (ticks > 0 ? ticks : 1);
+
+  uint8_t slot = job.deadlineTick % SCHEDULER_WHEEL_SLOTS;
+  job.next = wheel[slot];
+  wheel[slot] = id;
+  job.armed = true;
+}
+
+void Scheduler::unlink(uint8_t id) {
+  SchedulerJob& job = jobs[id];
+  if (!job.armed) return;
+
+  int8_t* link = &wheel[job.deadlineTick % SCHEDULER_WHEEL_SLOTS];
+  while (*link != -1) {
+    if (*link == id) {
+      *link = job.next;
+      break;
+    }
+    link = &jobs[*link].next;
+  }
+  job.next = -1;
+  job.armed = false;
+}
+
+void Scheduler::markReady(uint8_t id, uint32_t since) {
+  SchedulerJob& job = jobs[id];
+  if (job.ready) return;
+
+  unlink(id);
+  job.ready = true;
+  job.readyMicros = since;
+}
+
+void Scheduler::post(uint32_t events) {
+  uint32_t now = micros();
+  for (uint8_t i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+    if ((events & (1UL << i)) && !(pendingEvents.load() & (1UL << i))) {
+      eventMicros[i] = now;
+    }
+  }
+  pendingEvents.fetch_or(events);
+
+  if (owner != NULL && xTaskGetCurrentTaskHandle() != owner) {
+    xTaskNotifyGive(owner);
+  }
+}
+
+void IRAM_ATTR Scheduler::postFromISR(uint32_t events) {
+  uint32_t now = micros();
+  for (uint8_t i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+    if ((events & (1UL << i)) && !(pendingEvents.load() & (1UL << i))) {
+      eventMicros[i] = now;
+    }
+  }
+  pendingEvents.fetch_or(events);
+
+  if (owner != NULL) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(owner, &woken);
+    if (woken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
+
+void Scheduler::collectDue(uint32_t tick) {
+  // Якщо loop() відстав більше ніж на оберт, досить пройти колесо один раз
+  uint32_t steps = tick - currentTick + 1;
+  if (steps > SCHEDULER_WHEEL_SLOTS) {
+    steps = SCHEDULER_WHEEL_SLOTS;
+  }
+
+  for (uint32_t s = 0; s < steps; s++) {
+    int8_t id = wheel[(tick - s) % SCHEDULER_WHEEL_SLOTS];
+    while (id != -1) {
+      int8_t next = jobs[id].next;
+      // У слоті можуть бути задачі з наступних обертів
+      if ((int32_t)(tick - jobs[id].deadlineTick) >= 0) {
+        uint32_t lateMs = (tick - jobs[id].deadlineTick) * SCHEDULER_TICK_MS;
+        markReady(id, micros() - lateMs * 1000);
+      }
+      id = next;
+    }
+  }
+  currentTick = tick + 1;
+}
+
+void Scheduler::collectEvents() {
+  uint32_t events = pendingEvents.exchange(0);
+  if (events == 0) return;
+
+  for (uint8_t id = 0; id < jobCount; id++) {
+    uint32_t matched = jobs[id].events & events;
+    if (matched == 0) continue;
+
+    // Затримка рахується від найранішої події, що розбудила задачу
+    uint32_t since = micros();
+    for (uint8_t i = 0; i < SCHEDULER_EVENT_COUNT; i++) {
+      if ((matched & (1UL << i)) && (int32_t)(eventMicros[i] - since) < 0) {
+        since = eventMicros[i];
+      }
+    }
+    markReady(id, since);
+  }
+}
+
+void Scheduler::runReady() {
+  for (;;) {
+    // Найвищий пріоритет серед готових; задач мало, тож простий перебір
+    int8_t best = -1;
+    for (uint8_t id = 0; id < jobCount; id++) {
+      if (jobs[id].ready && (best == -1 || jobs[id].priority > jobs[best].priority)) {
+        best = id;
+      }
+    }
+    if (best == -1) return;
+
+    SchedulerJob& job = jobs[best];
+    job.ready = false;
+
+    uint32_t start = micros();
+    job.lastLatencyUs = start - job.readyMicros;
+    if (job.lastLatencyUs > job.maxLatencyUs) {
+      job.maxLatencyUs = job.lastLatencyUs;
+    }
+
+    uint32_t delayMs = job.callback();
+
+    uint32_t runUs = micros() - start;
+    if (runUs > job.maxRunUs) {
+      job.maxRunUs = runUs;
+    }
+    job.runs++;
+
+    arm(best, delayMs);
+  }
+}
+
+uint32_t Scheduler::msUntilNextDeadline() const {
+  // Перший непорожній слот від ще не розібраного тіку; задачі з дальших
+  // обертів дають зайве пробудження не частіше ніж раз на оберт
+  for (uint32_t s = 0; s < SCHEDULER_WHEEL_SLOTS; s++) {
+    uint32_t tick = currentTick + s;
+    int8_t id = wheel[tick % SCHEDULER_WHEEL_SLOTS];
+    while (id != -1) {
+      if (jobs[id].deadlineTick == tick) {
+        // Лише різниці тіків і мс, без абсолютного часу
+        int32_t waitMs = (int32_t)(tick - tickCount) * SCHEDULER_TICK_MS -
+                         (int32_t)(millis() - tickBaseMs);
+        return waitMs > 0 ? (uint32_t)waitMs : 0;
+      }
+      id = jobs[id].next;
+    }
+  }
+  return SCHEDULER_WHEEL_SLOTS * SCHEDULER_TICK_MS;
+}
+
+void Scheduler::updateStats(uint32_t now) {
+  uint32_t window = now - statsStart;
+  if (window < (uint32_t)SCHEDULER_STATS_WINDOW * 1000000) return;
+
+  idlePermille = (uint32_t)((uint64_t)sleepMicros * 1000 / window);
+  sleepMicros = 0;
+  statsStart = now;
+}
+
+void Scheduler::run() {
+  collectDue(nowTick());
+  collectEvents();
+  runReady();
+
+  uint32_t waitMs = msUntilNextDeadline();
+  if (waitMs > 0 && pendingEvents.load() == 0) {
+    // Сон до дедлайну або до першої події
+    uint32_t start = micros();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    sleepMicros += micros() - start;
+  }
+
+  updateStats(micros());
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+
+// Результат задачі: через скільки мс запустити її знову.
+// SCHEDULER_IDLE - лише за подією, таймер не потрібен.
+#define SCHEDULER_IDLE 0xFFFFFFFFUL
+
+// Джерела подій; задача будиться, якщо її маска перетинається з подією
+enum SchedulerEvent : uint32_t {
+  SCHED_EVENT_BUTTON  = 1UL << 0,  // у черзі кнопки з'явився жест
+  SCHED_EVENT_MESSAGE = 1UL << 1,  // у SPSC-черзі до UI з'явилось повідомлення
+  SCHED_EVENT_WEATHER = 1UL << 2,  // фонова задача погоди завершила запит або змінився ключ
+  SCHED_EVENT_LED     = 1UL << 3,  // LEDC завершив фазу ефекту світлодіода
+  SCHED_EVENT_REDRAW  = 1UL << 4,  // почалась анімація екрана
+  SCHED_EVENT_STORAGE = 1UL << 5   // змінені налаштування чекають запису у флеш
+};
+#define SCHEDULER_EVENT_COUNT 6
+
+typedef uint32_t (*SchedulerCallback)();
+
+struct SchedulerJob {
+  const char* name;
+  SchedulerCallback callback;
+  uint8_t priority;        // більший виконується першим
+  uint32_t events;
+  uint32_t deadlineTick;   // тік колеса, на якому задача має запуститися
+  uint32_t readyMicros;    // момент, з якого задача чекає на виконання
+  int8_t next;             // наступна задача в тому ж слоті колеса
+  bool armed;
+  bool ready;
+
+  uint32_t runs;
+  uint32_t lastLatencyUs;
+  uint32_t maxLatencyUs;
+  uint32_t maxRunUs;
+};
+
+// Кооперативний планувальник для loop(): дедлайни в колесі таймерів,
+// а між ними задача loop() спить на нотифікації FreeRTOS, яку будять
+// переривання й інші задачі через post()
+class Scheduler {
+private:
+  SchedulerJob jobs[SCHEDULER_MAX_JOBS];
+  uint8_t jobCount;
+  int8_t wheel[SCHEDULER_WHEEL_SLOTS];
+  uint32_t currentTick;  // усі слоти до цього тіку вже розібрані
+  // Тік лічиться сам, millis() дає лише приріст: переповнення millis()
+  // через 49.7 доби не відкидає тік назад
+  uint32_t tickCount;
+  uint32_t tickBaseMs;   // millis() на початку тіку tickCount
+
+  std::atomic<uint32_t> pendingEvents;
+  volatile uint32_t eventMicros[SCHEDULER_EVENT_COUNT];
+  TaskHandle_t owner;
+
+  uint32_t statsStart;
+  uint32_t sleepMicros;
+  uint32_t idlePermille;
+
+  uint32_t nowTick();
+  void arm(uint8_t id, uint32_t delayMs);
+  void unlink(uint8_t id);
+  void markReady(uint8_t id, uint32_t since);
+  void collectDue(uint32_t tick);
+  void collectEvents();
+  void runReady();
+  uint32_t msUntilNextDeadline() const;
+  void updateStats(uint32_t now);
+
+public:
+  Scheduler();
+
+  // Викликається з задачі, яка потім крутить run() - її й будитимуть події
+  void begin();
+
+  // firstDelayMs - перший запуск; SCHEDULER_IDLE - лише за подією.
+  // Повертає id задачі або -1, якщо місця немає.
+  int add(const char* name, SchedulerCallback callback, uint8_t priority,
+          uint32_t events, uint32_t firstDelayMs);
+
+  void post(uint32_t events);
+  void IRAM_ATTR postFromISR(uint32_t events);
+
+  // Один прохід: виконує все, що настало, і спить до наступного дедлайну
+  void run();
+
+  uint8_t getJobCount() const { return jobCount; }
+  const SchedulerJob& getJob(uint8_t id) const { return jobs[id]; }
+  // Частка часу сну за останнє вікно SCHEDULER_STATS_WINDOW, у проміле
+  uint32_t getIdlePermille() const { return idlePermille; }
+};
+
+#endif // SCHEDULER_H
\ No newline at end of file
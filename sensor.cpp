@@ -0,0 +1,50 @@
+#include "sensor.h"
+
+SensorManager::SensorManager(Adafruit_BMP280* sensor, SensorQueue* queue, Scheduler* sched,
+                             HistoryStore* log)
+  : bmp(sensor), out(queue), scheduler(sched), historyStore(log), taskHandle(NULL) {
+}
+
+void SensorManager::begin() {
+  if (taskHandle != NULL) return;
+
+  // Нормальний режим: датчик міряє безперервно, а читання - лише
+  // регістри результату, без очікування перетворення
+  bmp->setSampling(Adafruit_BMP280::MODE_NORMAL,
+                   SENSOR_TEMPERATURE_OVERSAMPLING,
+                   SENSOR_PRESSURE_OVERSAMPLING,
+                   SENSOR_IIR_FILTER,
+                   SENSOR_STANDBY);
+
+  xTaskCreate(taskEntry, "sensor", SENSOR_TASK_STACK, this, SENSOR_TASK_PRIORITY, &taskHandle);
+}
+
+void SensorManager::taskEntry(void* arg) {
+  static_cast<SensorManager*>(arg)->taskLoop();
+}
+
+void SensorManager::taskLoop() {
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    SensorSample raw;
+    raw.temperature = bmp->readTemperature();
+    raw.pressurePa = bmp->readPressure();
+    raw.timestamp = millis();
+
+    // Збій шини не потрапляє ні в кільце, ні на екран
+    if (!isnan(raw.pressurePa) && !isnan(raw.temperature) && raw.pressurePa > 0) {
+      filter.add(raw);
+      SensorSample sample = filter.median();
+
+      // Якщо UI не встигає, зайві вибірки відкидаються - важлива лише остання
+      if (out->push(sample)) {
+        scheduler->post(SCHED_EVENT_MESSAGE);
+      }
+      // Системний час, а не millis(): журнал переживає перезапуск
+      historyStore->add(time(NULL), sample.pressurePa, sample.temperature);
+    }
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL));
+  }
+}
\ No newline at end of file
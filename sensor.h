@@ -0,0 +1,39 @@
+#ifndef SENSOR_H
+#define SENSOR_H
+
+#include <Arduino.h>
+#include <Adafruit_BMP280.h>
+#include "config.h"
+#include "messages.h"
+#include "scheduler.h"
+#include "history.h"
+
+// Власна задача читає BMP280 по I2C і віддає вибірки в UI через
+// SPSC-чергу, тож повільна шина не затримує ні дисплей, ні сервер.
+// Датчик міряє сам у нормальному режимі з апаратним IIR, задача лише
+// забирає результат і віддає медіану останніх SENSOR_MEDIAN_WINDOW
+// (SensorFilter) - поодинокий збій читання не дійде до екрана.
+// Та сама медіана йде в журнал історії.
+class SensorManager {
+private:
+  Adafruit_BMP280* bmp;
+  SensorQueue* out;
+  Scheduler* scheduler;
+  HistoryStore* historyStore;
+  TaskHandle_t taskHandle;
+
+  // Сирі вибірки, пише лише задача датчика
+  SensorFilter filter;
+
+  static void taskEntry(void* arg);
+  void taskLoop();
+
+public:
+  SensorManager(Adafruit_BMP280* sensor, SensorQueue* queue, Scheduler* sched,
+                HistoryStore* log);
+
+  // Датчик уже має бути ініціалізований bmp.begin()
+  void begin();
+};
+
+#endif // SENSOR_H
\ No newline at end of file
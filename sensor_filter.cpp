@@ -0,0 +1,39 @@
+#include "sensor_filter.h"
+
+SensorFilter::SensorFilter() : head(0), count(0) {
+}
+
+void SensorFilter::add(const SensorSample& raw) {
+  ring[head] = raw;
+  head = (head + 1) % SENSOR_MEDIAN_WINDOW;
+  if (count < SENSOR_MEDIAN_WINDOW) {
+    count++;
+  }
+}
+
+// Вставка в упорядкований масив - для вікна з кількох значень досить
+static void insertSorted(float* values, uint8_t count, float value) {
+  uint8_t i = count;
+  while (i > 0 && values[i - 1] > value) {
+    values[i] = values[i - 1];
+    i--;
+  }
+  values[i] = value;
+}
+
+SensorSample SensorFilter::median() const {
+  float pressures[SENSOR_MEDIAN_WINDOW];
+  float temperatures[SENSOR_MEDIAN_WINDOW];
+
+  // Кільце завдовжки з вікно: порядок для медіани не важливий
+  for (uint8_t i = 0; i < count; i++) {
+    insertSorted(pressures, i, ring[i].pressurePa);
+    insertSorted(temperatures, i, ring[i].temperature);
+  }
+
+  SensorSample result;
+  result.pressurePa = pressures[count / 2];
+  result.temperature = temperatures[count / 2];
+  result.timestamp = ring[(head + SENSOR_MEDIAN_WINDOW - 1) % SENSOR_MEDIAN_WINDOW].timestamp;
+  return result;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= МЕДІАННИЙ ФІЛЬТР ДАТЧИКА =============
+// Кільце останніх SENSOR_MEDIAN_WINDOW сирих вибірок; тиск і температура
+// - окремі медіани вікна, тож поодинокий збій читання не дійде ні до
+// екрана, ні до журналу. Поки вікно не заповнене, медіана - з наявних.
+// Не залежить від Arduino, тому на ПК фільтр перевіряється окремо.
+
+#define SENSOR_MEDIAN_WINDOW 5  // непарне
+
+struct SensorSample {
+  float pressurePa;
+  float temperature;
+  uint32_t timestamp;
+};
+
+class SensorFilter {
+private:
+  SensorSample ring[SENSOR_MEDIAN_WINDOW];
+  uint8_t head;
+  uint8_t count;
+
+public:
+  SensorFilter();
+
+  void add(const SensorSample& raw);
+  // Медіана з часом останньої вибірки; лише після першого add().
+  // З парної кількості береться верхня з двох середніх.
+  SensorSample median() const;
+  uint8_t size() const { return count; }
+};
+
+#endif // SENSOR_FILTER_H
\ No newline at end of file
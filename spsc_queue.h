@@ -0,0 +1,61 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Кільцевий буфер без блокувань для рівно одного виробника й одного
+// споживача. tail пише лише виробник, head - лише споживач; release/acquire
+// гарантує, що споживач бачить елемент цілком записаним.
+// N - степінь двійки, лічильники вільно переповнюються.
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+private:
+  T items[N];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+  uint32_t dropped;  // пише лише виробник
+
+public:
+  SpscQueue() : head(0), tail(0), dropped(0) {}
+
+  // Лише з задачі-виробника; false - черга повна, повідомлення відкинуто
+  bool push(const T& item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) == N) {
+      dropped++;
+      return false;
+    }
+
+    items[t & (N - 1)] = item;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Лише з задачі-споживача
+  bool pop(T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    item = items[h & (N - 1)];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool isEmpty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+
+  size_t size() const {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+  uint32_t getDropped() const { return dropped; }
+};
+
+#endif // SPSC_QUEUE_H
\ No newline at end of file
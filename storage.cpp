@@ -1,50 +1,305 @@
 #include "storage.h"
+#include <esp_rom_crc.h>
+
+Storage::Storage(Scheduler* sched)
+  : scheduler(sched), changedAt(0), nvsWrites(0), settingsFlushes(0), skippedWrites(0) {
+  memset(&settings, 0, sizeof(settings));
+  memset(&stored, 0, sizeof(stored));
+}
 
 void Storage::begin() {
   preferences.begin(PREF_NAMESPACE, false);
+
+  if (!loadSettings()) {
+    migrateSettings();
+  }
 }
 
 // WiFi
+// Список мереж - один блоб: для кожної довжина і байти SSID,
+// потім довжина і байти пароля, без доповнення до повних полів
+#define NETWORKS_BLOB_MAX (WIFI_MAX_NETWORKS * (2 + WIFI_SSID_MAX + WIFI_PASSWORD_MAX))
+
+static size_t packField(uint8_t* out, const char* text, size_t maxLength) {
+  size_t length = strnlen(text, maxLength);
+  out[0] = (uint8_t)length;
+  memcpy(out + 1, text, length);
+  return length + 1;
+}
+
+static bool unpackField(const uint8_t* blob, size_t size, size_t& pos,
+                        char* out, size_t maxLength) {
+  if (pos >= size) return false;
+  size_t length = blob[pos++];
+  if (length > maxLength || pos + length > size) return false;
+  memcpy(out, blob + pos, length);
+  out[length] = '\0';
+  pos += length;
+  return true;
+}
+
 void Storage::saveWiFiCredentials(const String& ssid, const String& password) {
-  preferences.putString("ssid", ssid);
-  preferences.putString("password", password);
+  WiFiNetwork networks[WIFI_MAX_NETWORKS];
+  uint8_t count = loadNetworks(networks, WIFI_MAX_NETWORKS);
+
+  // Та сама мережа з новим паролем не дублюється, а піднімається нагору
+  uint8_t last = count;
+  for (uint8_t i = 0; i < count; i++) {
+    if (ssid == networks[i].ssid) {
+      last = i;
+      break;
+    }
+  }
+  if (last == count) {
+    last = count < WIFI_MAX_NETWORKS ? count++ : WIFI_MAX_NETWORKS - 1;
+  }
+  for (uint8_t i = last; i > 0; i--) {
+    networks[i] = networks[i - 1];
+  }
+  strlcpy(networks[0].ssid, ssid.c_str(), sizeof(networks[0].ssid));
+  strlcpy(networks[0].password, password.c_str(), sizeof(networks[0].password));
+
+  uint8_t blob[NETWORKS_BLOB_MAX];
+  size_t size = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    size += packField(blob + size, networks[i].ssid, WIFI_SSID_MAX);
+    size += packField(blob + size, networks[i].password, WIFI_PASSWORD_MAX);
+  }
+  preferences.putBytes("networks", blob, size);
+  nvsWrites++;
+
+  // Старі окремі ключі вже перенесені в список
+  if (preferences.isKey("ssid")) {
+    preferences.remove("ssid");
+    preferences.remove("password");
+    nvsWrites += 2;
+  }
+}
+
+uint8_t Storage::loadNetworks(WiFiNetwork* networks, uint8_t maxCount) {
+  uint8_t blob[NETWORKS_BLOB_MAX];
+  size_t size = preferences.getBytes("networks", blob, sizeof(blob));
+
+  if (size == 0) {
+    // Налаштування зі старої прошивки - одна мережа в окремих ключах
+    String ssid = preferences.getString("ssid", "");
+    if (ssid.length() == 0 || maxCount == 0) return 0;
+    strlcpy(networks[0].ssid, ssid.c_str(), sizeof(networks[0].ssid));
+    strlcpy(networks[0].password, preferences.getString("password", "").c_str(),
+            sizeof(networks[0].password));
+    return 1;
+  }
+
+  uint8_t count = 0;
+  size_t pos = 0;
+  while (count < maxCount && pos < size) {
+    if (!unpackField(blob, size, pos, networks[count].ssid, WIFI_SSID_MAX) ||
+        !unpackField(blob, size, pos, networks[count].password, WIFI_PASSWORD_MAX)) {
+      break;
+    }
+    count++;
+  }
+  return count;
 }
 
 String Storage::loadSSID() {
-  return preferences.getString("ssid", "");
+  WiFiNetwork network;
+  if (loadNetworks(&network, 1) == 0) return "";
+  return String(network.ssid);
+}
+
+bool Storage::loadLease(WiFiLease& lease) {
+  if (preferences.getBytes("wifi_lease", &lease, sizeof(lease)) != sizeof(lease)) {
+    return false;
+  }
+  lease.ssid[WIFI_SSID_MAX] = '\0';
+  return lease.ssid[0] != '\0';
 }
 
-String Storage::loadPassword() {
-  return preferences.getString("password", "");
+void Storage::saveLease(const WiFiLease& lease) {
+  preferences.putBytes("wifi_lease", &lease, sizeof(lease));
+  nvsWrites++;
+}
+
+// Налаштування
+// Блоб "settings": SettingsHeader, за ним Settings. Зіпсований або
+// невідомої версії блоб ігнорується - тоді діють старі ключі чи типові значення.
+#define SETTINGS_BLOB_MAX (sizeof(SettingsHeader) + sizeof(Settings))
+
+static uint32_t settingsCrc(const uint8_t* data, size_t length) {
+  return esp_rom_crc32_le(0, data, length);
+}
+
+bool Storage::loadSettings() {
+  uint8_t blob[SETTINGS_BLOB_MAX];
+  size_t size = preferences.getBytes("settings", blob, sizeof(blob));
+  if (size < sizeof(SettingsHeader)) return false;
+
+  SettingsHeader header;
+  memcpy(&header, blob, sizeof(header));
+  const uint8_t* payload = blob + sizeof(header);
+  if (header.version == 0 || header.version > SETTINGS_VERSION ||
+      header.length != size - sizeof(header) ||
+      header.crc != settingsCrc(payload, header.length)) {
+    return false;
+  }
+
+  // Типові значення для полів, яких старіша версія ще не мала
+  settings.alarmHour = 9;
+  settings.alarmMinute = 0;
+  settings.alarmEnabled = true;
+  settings.ledMode = LED_OFF;
+  settings.weatherKey[0] = '\0';
+  settings.alarmCount = 0;
+  memcpy(&settings, payload, min((size_t)header.length, sizeof(settings)));
+  settings.weatherKey[WEATHER_KEY_MAX - 1] = '\0';
+  if (settings.ledMode >= LED_MODE_COUNT) {
+    settings.ledMode = LED_OFF;
+  }
+  if (header.version < 2) {
+    convertLegacyAlarm();
+  }
+  if (settings.alarmCount > ALARM_SLOTS) {
+    settings.alarmCount = ALARM_SLOTS;
+  }
+  // Блоб старішої версії лишається як є, доки щось не зміниться
+  memcpy(&stored, &settings, sizeof(settings));
+  return true;
+}
+
+void Storage::migrateSettings() {
+  // Окремі ключі попередніх прошивок; без них - типові значення
+  settings.alarmHour = constrain(preferences.getInt("alarm_hour", 9), 0, 23);
+  settings.alarmMinute = constrain(preferences.getInt("alarm_min", 0), 0, 59);
+  settings.alarmEnabled = preferences.getBool("alarm_en", true);
+  int mode = preferences.getInt("led_mode", LED_OFF);
+  settings.ledMode = (mode >= 0 && mode < LED_MODE_COUNT) ? mode : LED_OFF;
+  strlcpy(settings.weatherKey, preferences.getString("weather_key", "").c_str(),
+          sizeof(settings.weatherKey));
+  convertLegacyAlarm();
+
+  static const char* const LEGACY_KEYS[] = {"alarm_hour", "alarm_min", "alarm_en", "led_mode", "weather_key"};
+  bool legacy = false;
+  for (uint8_t i = 0; i < sizeof(LEGACY_KEYS) / sizeof(LEGACY_KEYS[0]); i++) {
+    legacy = legacy || preferences.isKey(LEGACY_KEYS[i]);
+  }
+  if (!legacy) {
+    // Нічого переносити: блоб з'явиться з першою зміною
+    memcpy(&stored, &settings, sizeof(settings));
+    return;
+  }
+
+  // Спершу блоб, потім видалення: обрив живлення між ними
+  // лише повторить перенесення при наступному старті
+  writeSettings();
+  for (uint8_t i = 0; i < sizeof(LEGACY_KEYS) / sizeof(LEGACY_KEYS[0]); i++) {
+    if (preferences.isKey(LEGACY_KEYS[i])) {
+      preferences.remove(LEGACY_KEYS[i]);
+      nvsWrites++;
+    }
+  }
+}
+
+void Storage::convertLegacyAlarm() {
+  // Колишній єдиний будильник - щоденний, з тим самим станом
+  memset(settings.alarms, 0, sizeof(settings.alarms));
+  AlarmRule& alarm = settings.alarms[0];
+  alarm.id = 1;
+  alarm.hour = settings.alarmHour;
+  alarm.minute = settings.alarmMinute;
+  alarm.days = ALARM_EVERY_DAY;
+  alarm.flags = settings.alarmEnabled ? ALARM_ENABLED : 0;
+  settings.alarmCount = 1;
+}
+
+void Storage::writeSettings() {
+  uint8_t blob[SETTINGS_BLOB_MAX];
+  SettingsHeader header;
+  header.version = SETTINGS_VERSION;
+  header.reserved = 0;
+  header.length = sizeof(Settings);
+  header.crc = settingsCrc((const uint8_t*)&settings, sizeof(settings));
+  memcpy(blob, &header, sizeof(header));
+  memcpy(blob + sizeof(header), &settings, sizeof(settings));
+
+  preferences.putBytes("settings", blob, sizeof(blob));
+  nvsWrites++;
+  settingsFlushes++;
+  memcpy(&stored, &settings, sizeof(settings));
+}
+
+void Storage::markChanged() {
+  changedAt = millis();
+  if (scheduler != NULL) {
+    scheduler->post(SCHED_EVENT_STORAGE);
+  }
+}
+
+uint32_t Storage::service() {
+  // Зміни могли повернути все як було - тоді писати нічого
+  if (!isDirty()) return SCHEDULER_IDLE;
+
+  uint32_t elapsed = millis() - changedAt;
+  if (elapsed < SETTINGS_FLUSH_DELAY_MS) {
+    return SETTINGS_FLUSH_DELAY_MS - elapsed;
+  }
+  writeSettings();
+  return SCHEDULER_IDLE;
+}
+
+void Storage::flush() {
+  if (isDirty()) {
+    writeSettings();
+  }
 }
 
 // Будильник
-void Storage::saveAlarmSettings(int hour, int minute, bool enabled) {
-  preferences.putInt("alarm_hour", hour);
-  preferences.putInt("alarm_min", minute);
-  preferences.putBool("alarm_en", enabled);
+void Storage::saveAlarms(const AlarmRule* alarms, uint8_t count) {
+  if (count > ALARM_SLOTS) count = ALARM_SLOTS;
+
+  // Хвіст за count теж порівнюється, тож його тримаємо нулями
+  AlarmRule packed[ALARM_SLOTS];
+  memset(packed, 0, sizeof(packed));
+  memcpy(packed, alarms, count * sizeof(AlarmRule));
+  if (settings.alarmCount == count && memcmp(settings.alarms, packed, sizeof(packed)) == 0) {
+    skippedWrites++;
+    return;
+  }
+  settings.alarmCount = count;
+  memcpy(settings.alarms, packed, sizeof(packed));
+  markChanged();
 }
 
-void Storage::loadAlarmSettings(int& hour, int& minute, bool& enabled) {
-  hour = preferences.getInt("alarm_hour", 9);
-  minute = preferences.getInt("alarm_min", 0);
-  enabled = preferences.getBool("alarm_en", true);
+uint8_t Storage::loadAlarms(AlarmRule* alarms, uint8_t maxCount) {
+  uint8_t count = min(settings.alarmCount, maxCount);
+  memcpy(alarms, settings.alarms, count * sizeof(AlarmRule));
+  return count;
 }
 
 // LED
 void Storage::saveLEDMode(LedMode mode) {
-  preferences.putInt("led_mode", (int)mode);
+  if (settings.ledMode == mode) {
+    skippedWrites++;
+    return;
+  }
+  settings.ledMode = mode;
+  markChanged();
 }
 
 LedMode Storage::loadLEDMode() {
-  return (LedMode)preferences.getInt("led_mode", LED_OFF);
+  return (LedMode)settings.ledMode;
 }
 
 // Weather API
 void Storage::saveWeatherApiKey(const String& apiKey) {
-  preferences.putString("weather_key", apiKey);
+  if (apiKey == settings.weatherKey) {
+    skippedWrites++;
+    return;
+  }
+  strlcpy(settings.weatherKey, apiKey.c_str(), sizeof(settings.weatherKey));
+  markChanged();
 }
 
 String Storage::loadWeatherApiKey() {
-  return preferences.getString("weather_key", "");
+  return String(settings.weatherKey);
 }
\ No newline at end of file
@@ -4,28 +4,98 @@
 #include <Preferences.h>
 #include <Arduino.h>
 #include "config.h"
+#include "scheduler.h"
+#include "alarm_schedule.h"
+
+struct WiFiNetwork {
+  char ssid[WIFI_SSID_MAX + 1];
+  char password[WIFI_PASSWORD_MAX + 1];
+};
+
+// Остання вдала асоціація: точка доступу й адреса від DHCP,
+// щоб після перезапуску підключитись без сканування і DHCP
+struct WiFiLease {
+  char ssid[WIFI_SSID_MAX + 1];
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+// Налаштування UI, що живуть у RAM і пишуться у флеш одним блобом.
+// Поля лише додаються в кінець: блоб старішої версії коротший,
+// а відсутні в ньому поля лишаються за замовчуванням.
+struct Settings {
+  uint8_t alarmHour;       // єдиний будильник версії 1, з версії 2 не пишеться
+  uint8_t alarmMinute;
+  bool alarmEnabled;
+  uint8_t ledMode;
+  char weatherKey[WEATHER_KEY_MAX];
+  // Версія 2
+  uint8_t alarmCount;
+  AlarmRule alarms[ALARM_SLOTS];
+};
+
+struct SettingsHeader {
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t length;   // розмір Settings у версії, що писала
+  uint32_t crc;      // CRC32 байтів Settings
+};
 
 class Storage {
 private:
   Preferences preferences;
+  Scheduler* scheduler;
+
+  // settings - робоча копія, stored - те, що зараз у флеші
+  Settings settings;
+  Settings stored;
+  uint32_t changedAt;
+
+  uint32_t nvsWrites;
+  uint32_t settingsFlushes;
+  uint32_t skippedWrites;
+
+  bool loadSettings();
+  void migrateSettings();
+  void convertLegacyAlarm();
+  void writeSettings();
+  void markChanged();
 
 public:
+  Storage(Scheduler* sched);
+
   void begin();
+
+  // Для задачі UI за SCHED_EVENT_STORAGE: пише змінені налаштування,
+  // коли зміни стихли на SETTINGS_FLUSH_DELAY_MS. Повертає, через
+  // скільки мс перевірити знову, або SCHEDULER_IDLE.
+  uint32_t service();
+  // Негайний запис, напр. перед перезапуском
+  void flush();
+  bool isDirty() const { return memcmp(&settings, &stored, sizeof(settings)) != 0; }
+
+  uint32_t getNvsWrites() const { return nvsWrites; }
+  uint32_t getSettingsFlushes() const { return settingsFlushes; }
+  uint32_t getSkippedWrites() const { return skippedWrites; }
   
-  // WiFi
+  // WiFi: нова мережа стає першою в списку, найстаріша випадає
   void saveWiFiCredentials(const String& ssid, const String& password);
-  String loadSSID();
-  String loadPassword();
+  uint8_t loadNetworks(WiFiNetwork* networks, uint8_t maxCount);
+  String loadSSID();  // мережа з найвищим пріоритетом
+  bool loadLease(WiFiLease& lease);
+  void saveLease(const WiFiLease& lease);
   
-  // Будильник
-  void saveAlarmSettings(int hour, int minute, bool enabled);
-  void loadAlarmSettings(int& hour, int& minute, bool& enabled);
+  // Будильники, LED і ключ погоди - лише в RAM, у флеш їх пише service()
+  void saveAlarms(const AlarmRule* alarms, uint8_t count);
+  uint8_t loadAlarms(AlarmRule* alarms, uint8_t maxCount);
   
-  // LED
   void saveLEDMode(LedMode mode);
   LedMode loadLEDMode();
   
-  // Weather API
   void saveWeatherApiKey(const String& apiKey);
   String loadWeatherApiKey();
 };
@@ -0,0 +1,211 @@
+#include "synth.h"
+
+// Один період синуса, 256 точок, амплітуда Q15
+static const int16_t SINE_TABLE[256] = {
+       0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+    6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+   12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+   18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+   23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+   27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+   30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+   32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+   32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+   32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+   30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+   27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+   23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+   18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+   12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+    6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+       0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+   -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+  -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+  -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+  -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+  -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+  -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+  -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+  -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+  -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+  -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+  -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+  -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+  -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+  -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+   -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+};
+
+// ============= ПАТЕРНИ =============
+// 3 сигнали 1 кГц по 200 мс і пауза перед повтором
+static const SynthNote BEEP_NOTES[] = {
+  {1000, 200}, {0, 100}, {1000, 200}, {0, 100}, {1000, 200}, {0, 600}
+};
+
+// Арпеджіо C6-E6-G6-C7
+static const SynthNote MELODY_NOTES[] = {
+  {1047, 150}, {1319, 150}, {1568, 150}, {2093, 300}, {0, 500}
+};
+
+const SynthPattern SYNTH_PATTERN_BEEP = {
+  BEEP_NOTES, sizeof(BEEP_NOTES) / sizeof(BEEP_NOTES[0]),
+  {5, 20, 26000, 20},
+  {6000, 3000, 30000}
+};
+
+const SynthPattern SYNTH_PATTERN_MELODY = {
+  MELODY_NOTES, sizeof(MELODY_NOTES) / sizeof(MELODY_NOTES[0]),
+  {10, 60, 20000, 80},
+  {6000, 3000, 30000}
+};
+
+// ============= SYNTH =============
+Synth::Synth(uint32_t rate)
+  : sampleRate(rate), pattern(NULL), loopsLeft(0), noteIndex(0), gain(0),
+    phase(0), phaseStep(0), stage(STAGE_DONE), level(0), levelStep(0),
+    stageSamplesLeft(0), noteSamplesLeft(0), releaseSamples(0) {
+}
+
+uint32_t Synth::msToSamples(uint16_t ms) const {
+  return (uint32_t)((uint64_t)sampleRate * ms / 1000);
+}
+
+void Synth::start(const SynthPattern* pat, uint16_t loops) {
+  if (pat == NULL || pat->noteCount == 0) {
+    stop();
+    return;
+  }
+
+  pattern = pat;
+  loopsLeft = loops > 0 ? loops : 1;
+  noteIndex = 0;
+  gain = pat->ramp.startGain;
+  startNote();
+}
+
+void Synth::stop() {
+  pattern = NULL;
+  stage = STAGE_DONE;
+  level = 0;
+  levelStep = 0;
+}
+
+void Synth::startNote() {
+  const SynthNote& note = pattern->notes[noteIndex];
+
+  noteSamplesLeft = msToSamples(note.durationMs);
+  releaseSamples = msToSamples(pattern->envelope.releaseMs);
+  if (releaseSamples > noteSamplesLeft) {
+    releaseSamples = noteSamplesLeft;
+  }
+
+  // Приріст фази: freq * 2^32 / sampleRate
+  phase = 0;
+  phaseStep = (uint32_t)(((uint64_t)note.freqHz << 32) / sampleRate);
+  level = 0;
+
+  if (note.freqHz == 0) {
+    enterStage(STAGE_DONE);
+  } else {
+    enterStage(STAGE_ATTACK);
+  }
+}
+
+void Synth::enterStage(Stage next) {
+  const SynthEnvelope& env = pattern->envelope;
+  int32_t target;
+
+  stage = next;
+  switch (next) {
+    case STAGE_ATTACK:
+      stageSamplesLeft = msToSamples(env.attackMs);
+      target = (int32_t)SYNTH_Q15_ONE << 16;
+      break;
+
+    case STAGE_DECAY:
+      stageSamplesLeft = msToSamples(env.decayMs);
+      target = (int32_t)env.sustainLevel << 16;
+      break;
+
+    case STAGE_RELEASE:
+      stageSamplesLeft = releaseSamples;
+      target = 0;
+      break;
+
+    case STAGE_SUSTAIN:
+      stageSamplesLeft = 0;
+      levelStep = 0;
+      return;
+
+    default:
+      stageSamplesLeft = 0;
+      level = 0;
+      levelStep = 0;
+      return;
+  }
+
+  // Ділення з округленням до нуля не дає перескочити ціль
+  if (stageSamplesLeft == 0) {
+    level = target;
+    levelStep = 0;
+  } else {
+    levelStep = (target - level) / (int32_t)stageSamplesLeft;
+  }
+}
+
+size_t Synth::render(int16_t* out, size_t count) {
+  size_t produced = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    // Нота коротша за семпл не звучить: одразу наступна, інакше
+    // noteSamplesLeft-- нижче перейшов би через нуль
+    while (pattern != NULL && noteSamplesLeft == 0) {
+      noteIndex++;
+      if (noteIndex >= pattern->noteCount) {
+        noteIndex = 0;
+        loopsLeft--;
+        if (loopsLeft == 0) {
+          stop();
+        } else {
+          // Кожен повтор гучніший за попередній
+          gain += pattern->ramp.stepGain;
+          if (gain > pattern->ramp.maxGain) {
+            gain = pattern->ramp.maxGain;
+          }
+        }
+      }
+      if (pattern != NULL) {
+        startNote();
+      }
+    }
+
+    if (pattern == NULL) {
+      out[i] = 0;
+      continue;
+    }
+
+    if (stage != STAGE_DONE) {
+      if (stage != STAGE_RELEASE && noteSamplesLeft == releaseSamples) {
+        enterStage(STAGE_RELEASE);
+      } else {
+        while (stageSamplesLeft == 0 && (stage == STAGE_ATTACK || stage == STAGE_DECAY)) {
+          enterStage((Stage)(stage + 1));
+        }
+      }
+    }
+
+    // Два множення на семпл: огинаюча і загальна гучність
+    int32_t sample = ((int32_t)SINE_TABLE[phase >> 24] * (level >> 16)) >> 15;
+    out[i] = (int16_t)((sample * gain) >> 15);
+
+    phase += phaseStep;
+    level += levelStep;
+    if (stageSamplesLeft > 0) {
+      stageSamplesLeft--;
+    }
+    noteSamplesLeft--;
+    produced++;
+  }
+
+  return produced;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= СИНТЕЗАТОР ТОНІВ =============
+// Лише цілочисельна арифметика: таблиця синуса, DDS-фаза 32 біти,
+// огинаюча ADSR і гучність у Q15. Не залежить від Arduino,
+// тому результат побітово однаковий на пристрої і на ПК.
+
+#define SYNTH_Q15_ONE 32767
+
+struct SynthEnvelope {
+  uint16_t attackMs;
+  uint16_t decayMs;
+  uint16_t sustainLevel;  // Q15
+  uint16_t releaseMs;
+};
+
+// Частота 0 - пауза
+struct SynthNote {
+  uint16_t freqHz;
+  uint16_t durationMs;
+};
+
+// Гучність зростає на stepGain з кожним повтором патерну
+struct SynthRamp {
+  uint16_t startGain;  // Q15
+  uint16_t stepGain;   // Q15
+  uint16_t maxGain;    // Q15
+};
+
+struct SynthPattern {
+  const SynthNote* notes;
+  uint8_t noteCount;
+  SynthEnvelope envelope;
+  SynthRamp ramp;
+};
+
+extern const SynthPattern SYNTH_PATTERN_BEEP;
+extern const SynthPattern SYNTH_PATTERN_MELODY;
+
+class Synth {
+private:
+  enum Stage {
+    STAGE_ATTACK = 0,
+    STAGE_DECAY,
+    STAGE_SUSTAIN,
+    STAGE_RELEASE,
+    STAGE_DONE
+  };
+
+  uint32_t sampleRate;
+  const SynthPattern* pattern;
+  uint16_t loopsLeft;
+  uint8_t noteIndex;
+  int32_t gain;  // Q15
+
+  // DDS
+  uint32_t phase;
+  uint32_t phaseStep;
+
+  // Огинаюча: рівень Q15 << 16 для дробового кроку
+  Stage stage;
+  int32_t level;
+  int32_t levelStep;
+  uint32_t stageSamplesLeft;
+  uint32_t noteSamplesLeft;
+  uint32_t releaseSamples;
+
+  uint32_t msToSamples(uint16_t ms) const;
+  void startNote();
+  void enterStage(Stage next);
+
+public:
+  explicit Synth(uint32_t rate);
+
+  void start(const SynthPattern* pat, uint16_t loops);
+  void stop();
+  bool isActive() const { return pattern != NULL; }
+  uint16_t getGain() const { return (uint16_t)gain; }
+
+  // Заповнює count семплів; після завершення патерну - тиша.
+  // Повертає кількість семплів з корисним сигналом.
+  size_t render(int16_t* out, size_t count);
+};
+
+#endif // SYNTH_H
\ No newline at end of file
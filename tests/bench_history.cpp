@@ -0,0 +1,153 @@
+#include "check.h"
+#include "timeseries.h"
+
+#include <chrono>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+// ============= БЕНЧМАРК ЗАПИТІВ ДО ЖУРНАЛУ =============
+// Рік вибірок раз на 10 с у носії в RAM, далі запити /history різної
+// довжини: рівень, кількість точок, читань блоків і час на запит.
+// Читання рахуються окремо: на платі кожне - звернення до LittleFS,
+// тож саме вони, а не мікросекунди ПК, показують ціну запиту.
+
+#define BENCH_START     1700000000u
+#define BENCH_DAYS      400
+#define BENCH_STEP      10
+#define BENCH_GAP_FROM  (BENCH_START + 3 * 86400)   // пропуск: плата була вимкнена
+#define BENCH_GAP_SEC   5000
+#define BENCH_BATCH     16      // як HISTORY_READ_BATCH у /history
+#define BENCH_ROUNDS    50
+
+class RamMedium : public HistoryMedium {
+public:
+  std::vector<HistoryBlock> tiers[HISTORY_TIER_COUNT];
+  uint32_t reads;
+  uint32_t writes;
+
+  RamMedium() : reads(0), writes(0) {
+    for (uint8_t i = 0; i < HISTORY_TIER_COUNT; i++) {
+      tiers[i].resize(HISTORY_TIERS[i].slots);
+      memset(tiers[i].data(), 0, tiers[i].size() * sizeof(HistoryBlock));
+    }
+  }
+
+  bool readBlock(uint8_t tier, uint16_t slot, HistoryBlock& block) override {
+    reads++;
+    block = tiers[tier][slot];
+    return true;
+  }
+
+  bool writeBlock(uint8_t tier, uint16_t slot, const HistoryBlock& block) override {
+    writes++;
+    tiers[tier][slot] = block;
+    return true;
+  }
+};
+
+struct Query {
+  const char* name;
+  uint32_t back;         // від останньої вибірки, с
+  uint32_t length;
+  uint32_t resolution;
+};
+
+static const Query QUERIES[] = {
+  {"1h", 3600, 3600, 0},
+  {"24h", 86400, 86400, 0},
+  {"day before", 2 * 86400, 86400, 60},
+  {"7d", 7 * 86400, 7 * 86400, 0},
+  {"30d", 30 * 86400, 30 * 86400, 0},
+  {"30d @1h", 30 * 86400, 30 * 86400, 3600},
+  {"1y", 365 * 86400, 365 * 86400, 0},
+  {"1y @1d", 365 * 86400, 365 * 86400, 86400}
+};
+
+static HistoryPoint sampleAt(uint32_t time) {
+  uint32_t s = time - BENCH_START;
+  HistoryPoint point;
+  point.time = time;
+  point.pressurePa = (int32_t)lround(101325 + 800 * sin(s / 40000.0));
+  point.temperatureDeci = (int16_t)lround(215 + 30 * sin(s / 86400.0 * 6.283));
+  return point;
+}
+
+int main() {
+  static RamMedium medium;
+  static HistoryLog log(&medium);
+  log.begin();
+
+  auto fillStart = std::chrono::steady_clock::now();
+  uint32_t samples = 0;
+  for (uint32_t time = BENCH_START; time < BENCH_START + BENCH_DAYS * 86400u; time += BENCH_STEP) {
+    if (time >= BENCH_GAP_FROM && time < BENCH_GAP_FROM + BENCH_GAP_SEC) continue;
+    log.add(sampleAt(time));
+    samples++;
+  }
+  double fillMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - fillStart).count();
+  printf("fill: %u samples, %u block writes, %.0f ms\n", samples, log.getBlockWrites(), fillMs);
+
+  // Після перезавантаження журнал продовжується з носія; втрачається
+  // лише ще не синхронізований хвіст
+  static HistoryLog reopened(&medium);
+  reopened.begin();
+  uint32_t latest = log.getLatestTime();
+  CHECK(reopened.getLatestTime() <= latest);
+  CHECK(latest - reopened.getLatestTime() <= HISTORY_SYNC_SECONDS);
+
+  printf("%-12s %4s %6s %6s %6s %9s\n", "query", "tier", "points", "reads", "blocks", "us");
+  for (const Query& query : QUERIES) {
+    uint32_t from = latest - query.back;
+    uint32_t to = from + query.length;
+    HistoryCursor cursor;
+    HistoryPoint batch[BENCH_BATCH];
+
+    // Перший прохід - перевірки і лічильник читань
+    medium.reads = 0;
+    log.open(cursor, from, to, query.resolution);
+    uint32_t searchReads = medium.reads;
+    size_t points = 0;
+    uint32_t previous = 0;
+    bool ordered = true;
+    bool inRange = true;
+    bool spaced = true;
+    size_t n;
+    while ((n = log.read(cursor, batch, BENCH_BATCH)) > 0) {
+      for (size_t i = 0; i < n; i++) {
+        const HistoryPoint& point = batch[i];
+        if (points > 0 && point.time <= previous) ordered = false;
+        if (points > 0 && point.time - previous < cursor.step) spaced = false;
+        if (point.time < from || point.time > to) inRange = false;
+        previous = point.time;
+        points++;
+      }
+    }
+    uint32_t reads = medium.reads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+      log.open(cursor, from, to, query.resolution);
+      while (log.read(cursor, batch, BENCH_BATCH) > 0) {}
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ROUNDS;
+
+    uint16_t slots = HISTORY_TIERS[cursor.tier].slots;
+    printf("%-12s %4u %6zu %6u %6u %9.1f\n", query.name, cursor.tier, points, reads, slots, us);
+
+    CHECK(points > 0);
+    CHECK(ordered);
+    CHECK(inRange);
+    CHECK(spaced);
+    // Двійковий пошук: не більше log2(слотів) + 1 читань до першого блоку
+    uint32_t searchLimit = 1;
+    while ((1u << (searchLimit - 1)) < slots) searchLimit++;
+    CHECK(searchReads <= searchLimit);
+    // Кожен блок діапазону читається один раз
+    uint32_t span = to - from;
+    uint32_t perBlock = HISTORY_BLOCK_SAMPLES * HISTORY_TIERS[cursor.tier].interval;
+    CHECK(reads - searchReads <= span / perBlock + 3);
+  }
+
+  return checkResult("history");
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "check.h"
+#include "http_server.h"
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+// ============= НАВАНТАЖЕННЯ HTTP-СЕРВЕРА =============
+// HttpServer на POSIX-сокетах через loopback: сервер в одному потоці,
+// як задача мережі на платі, клієнти - в окремих потоках. Для кожного
+// сценарію - запитів за секунду і затримка від запиту до кінця відповіді.
+// Абсолютні числа - про ПК, порівнювати варто зміни між версіями.
+// Виділення купи в потоці сервера рахує перехоплений malloc(): відповідь
+// через reserve()/commit() чи з флешу не має чіпати купу зовсім.
+
+#define BENCH_PORT_FIRST 18080
+#define BENCH_PORT_TRIES 20
+#define BENCH_CLIENTS    4      // менше за HTTP_MAX_CONNECTIONS
+#define STATIC_BYTES     8192
+#define STATUS_FIELDS    64     // тіло ~1.7 КБ, як у /status
+#define STATUS_BYTES     (STATUS_FIELDS * 26 + 1)
+
+static uint8_t staticBody[STATIC_BYTES];
+
+struct Scenario {
+  const char* name;
+  const char* path;
+  bool keepAlive;
+  uint32_t perClient;
+  size_t bodyBytes;
+  bool heapFree;       // обробник і сервер не мають виділяти купу
+};
+
+static const Scenario SCENARIOS[] = {
+  {"keep-alive /hello", "/hello", true, 5000, 5, true},
+  {"keep-alive /static 8K", "/static", true, 500, STATIC_BYTES, true},
+  {"keep-alive /status", "/status", true, 2000, STATUS_BYTES, true},
+  {"keep-alive /status String", "/status-string", true, 2000, STATUS_BYTES, false},
+  {"close /hello", "/hello", false, 300, 5, true}
+};
+
+// ============= ЛІЧИЛЬНИК КУПИ =============
+// glibc: malloc() програми перехоплюється, справжній - __libc_malloc().
+// operator new іде через malloc(), тож його теж видно. Рахується лише
+// потік сервера - клієнти й std::thread не заважають.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+static thread_local bool countHeap = false;
+static std::atomic<uint32_t> heapAllocs(0);
+
+extern "C" void* malloc(size_t size) {
+  if (countHeap) heapAllocs++;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+  if (countHeap) heapAllocs++;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  if (countHeap) heapAllocs++;
+  return __libc_realloc(ptr, size);
+}
+
+// Поле тіла /status: рівно 26 байтів
+static int formatField(char* buffer, size_t room, int index) {
+  return snprintf(buffer, room, "\"field%02d\":%15d,", index % 100, index * 1000);
+}
+
+static int connectTo(uint16_t port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+
+  int enable = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Одна відповідь цілком: статус, заголовки, тіло за Content-Length
+static bool readResponse(int fd, std::vector<char>& buffer, int& status, size_t& bodyBytes) {
+  size_t length = 0;
+  size_t headEnd = 0;
+  size_t total = 0;
+
+  for (;;) {
+    if (length == buffer.size()) buffer.resize(buffer.size() * 2);
+    ssize_t n = recv(fd, buffer.data() + length, buffer.size() - length, 0);
+    if (n <= 0) return false;
+    length += n;
+
+    if (!headEnd) {
+      char* end = (char*)memmem(buffer.data(), length, "\r\n\r\n", 4);
+      if (!end) continue;
+      headEnd = end - buffer.data() + 4;
+
+      buffer[headEnd - 1] = '\0';
+      status = atoi(buffer.data() + 9);
+      const char* field = strcasestr(buffer.data(), "\r\nContent-Length:");
+      bodyBytes = field ? strtoul(field + 17, NULL, 10) : 0;
+      total = headEnd + bodyBytes;
+    }
+    if (length >= total) return length == total;
+  }
+}
+
+static bool sendRequest(int fd, const Scenario& scenario) {
+  char request[128];
+  int length = snprintf(request, sizeof(request),
+                        "GET %s HTTP/1.1\r\nHost: bench\r\nConnection: %s\r\n\r\n",
+                        scenario.path, scenario.keepAlive ? "keep-alive" : "close");
+  return send(fd, request, length, MSG_NOSIGNAL) == length;
+}
+
+static void runClient(uint16_t port, const Scenario& scenario,
+                      std::vector<uint32_t>& latencies, uint32_t& failures) {
+  std::vector<char> buffer(STATIC_BYTES + 512);
+  int fd = -1;
+
+  for (uint32_t i = 0; i < scenario.perClient; i++) {
+    if (fd < 0) fd = connectTo(port);
+    if (fd < 0) {
+      failures++;
+      continue;
+    }
+
+    uint32_t start = micros();
+    int status = 0;
+    size_t bodyBytes = 0;
+    bool ok = sendRequest(fd, scenario) && readResponse(fd, buffer, status, bodyBytes);
+    latencies.push_back(micros() - start);
+
+    if (!ok || status != 200 || bodyBytes != scenario.bodyBytes) failures++;
+    if (!ok || !scenario.keepAlive) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if (fd >= 0) close(fd);
+}
+
+static uint32_t percentile(std::vector<uint32_t>& sorted, uint32_t percent) {
+  if (sorted.empty()) return 0;
+  size_t index = (sorted.size() * percent + 99) / 100;
+  return sorted[index ? index - 1 : 0];
+}
+
+int main() {
+  signal(SIGPIPE, SIG_IGN);
+  for (size_t i = 0; i < sizeof(staticBody); i++) staticBody[i] = (uint8_t)i;
+
+  // Порт може бути зайнятий - пробуємо кілька
+  HttpServer* server = NULL;
+  uint16_t port = 0;
+  for (uint16_t p = BENCH_PORT_FIRST; p < BENCH_PORT_FIRST + BENCH_PORT_TRIES && !server; p++) {
+    HttpServer* candidate = new HttpServer(p);
+    if (candidate->begin()) {
+      server = candidate;
+      port = p;
+    } else {
+      delete candidate;
+    }
+  }
+  if (!server) {
+    printf("http server: no free port\n");
+    return 1;
+  }
+
+  server->on("/hello", HTTP_METHOD_GET, [server](HttpRequest& req) {
+    char* body = server->reserve(req, 200, "text/plain", 5);
+    if (body) {
+      memcpy(body, "hello", 5);
+      server->commit(req);
+    }
+  });
+  server->on("/static", HTTP_METHOD_GET, [server](HttpRequest& req) {
+    server->sendStatic(req, 200, "application/octet-stream", staticBody, sizeof(staticBody));
+  });
+  // Як sendJson(): довжина відома наперед, тіло пишеться в буфер з'єднання
+  server->on("/status", HTTP_METHOD_GET, [server](HttpRequest& req) {
+    char* body = server->reserve(req, 200, "application/json", STATUS_BYTES);
+    if (!body) return;
+    for (int i = 0; i < STATUS_FIELDS; i++) {
+      formatField(body + i * 26, 27, i);
+    }
+    body[STATUS_BYTES - 1] = '}';
+    server->commit(req);
+  });
+  // Як до reserve(): тіло збирається в String і копіюється send()
+  server->on("/status-string", HTTP_METHOD_GET, [server](HttpRequest& req) {
+    String body;
+    char field[32];
+    for (int i = 0; i < STATUS_FIELDS; i++) {
+      formatField(field, sizeof(field), i);
+      body += field;
+    }
+    body += '}';
+    server->send(req, 200, "application/json", body);
+  });
+
+  std::atomic<bool> running(true);
+  std::thread serverTask([&] {
+    countHeap = true;
+    while (running.load()) server->service(5);
+  });
+
+  printf("%-28s %8s %10s %8s %8s %8s %9s\n",
+         "scenario", "requests", "req/s", "p50 us", "p99 us", "max us", "allocs/req");
+  uint32_t expectedRequests = 0;
+
+  for (const Scenario& scenario : SCENARIOS) {
+    heapAllocs.store(0);
+    std::vector<std::vector<uint32_t>> latencies(BENCH_CLIENTS);
+    std::vector<uint32_t> failures(BENCH_CLIENTS, 0);
+    std::vector<std::thread> clients;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int c = 0; c < BENCH_CLIENTS; c++) {
+      clients.emplace_back(runClient, port, std::cref(scenario),
+                           std::ref(latencies[c]), std::ref(failures[c]));
+    }
+    for (std::thread& client : clients) client.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<uint32_t> all;
+    uint32_t failed = 0;
+    for (int c = 0; c < BENCH_CLIENTS; c++) {
+      all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+      failed += failures[c];
+    }
+    std::sort(all.begin(), all.end());
+
+    // Останню відповідь клієнт уже прочитав, тож сервер з нею закінчив
+    double allocsPerRequest = all.empty() ? 0 : (double)heapAllocs.load() / all.size();
+
+    printf("%-28s %8zu %10.0f %8u %8u %8u %9.2f\n", scenario.name, all.size(), all.size() / seconds,
+           percentile(all, 50), percentile(all, 99), all.empty() ? 0 : all.back(), allocsPerRequest);
+    CHECK_EQ(failed, 0);
+    if (scenario.heapFree) {
+      CHECK_EQ(heapAllocs.load(), 0);
+    }
+    expectedRequests += scenario.perClient * BENCH_CLIENTS;
+  }
+
+  running.store(false);
+  serverTask.join();
+
+  printf("server: requests=%u rejected=%u reused=%u timeouts=%u peak=%u max response=%u us\n",
+         server->getRequests(), server->getRejected(), server->getReused(), server->getTimeouts(),
+         server->getPeakConnections(), server->getMaxResponseUs());
+  CHECK_EQ(server->getRequests(), expectedRequests);
+  CHECK_EQ(server->getRejected(), 0);
+  CHECK(server->getPeakConnections() <= BENCH_CLIENTS);
+
+  delete server;
+  return checkResult("http server");
+}
\ No newline at end of file
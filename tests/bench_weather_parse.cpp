@@ -0,0 +1,197 @@
+#include "check.h"
+#include "weather.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// ============= БЕНЧМАРК РОЗБОРУ ПОГОДИ =============
+// Порівнює старий шлях (http.getString() у купу + StaticJsonDocument<1024>)
+// з parseWeather() із weather.cpp - тим самим фільтром і документом, що на
+// платі. Купа рахується перевизначеними operator new/delete, документ
+// старого шляху - через memoryUsage(). На 64-бітному ПК слоти ArduinoJson
+// удвічі більші: старому документу місткість множиться на SLOT_SCALE, а
+// WEATHER_DOC_BYTES лишається як є - що вміщується тут, вміститься й на ESP32.
+
+#define SLOT_SCALE       (sizeof(void*) / 4)
+#define OLD_DOC_BYTES    1024
+#define BENCH_ROUNDS     2000
+
+static const char* const PAYLOADS[] = {
+  "weather_en.json",
+  "weather_uk.json",
+  "weather_alerts.json"
+};
+
+// ============= ЛІЧИЛЬНИК КУПИ =============
+static size_t heapNow = 0;
+static size_t heapPeak = 0;
+
+void* operator new(size_t size) {
+  size_t* block = (size_t*)malloc(size + sizeof(size_t));
+  if (!block) abort();
+  block[0] = size;
+  heapNow += size;
+  if (heapNow > heapPeak) heapPeak = heapNow;
+  return block + 1;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (!ptr) return;
+  size_t* block = (size_t*)ptr - 1;
+  heapNow -= block[0];
+  free(block);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+static void heapMark() {
+  heapPeak = heapNow;
+}
+
+static size_t heapUsedSinceMark(size_t base) {
+  return heapPeak - base;
+}
+
+// Сокет HTTPClient: читання з уже отриманих даних, без копій
+class MemoryStream : public Stream {
+private:
+  const char* data;
+  size_t size;
+  size_t pos;
+
+public:
+  MemoryStream(const char* bytes, size_t length) : data(bytes), size(length), pos(0) {}
+
+  int available() override { return (int)(size - pos); }
+  int read() override { return pos < size ? (unsigned char)data[pos++] : -1; }
+};
+
+struct ParseResult {
+  bool ok;
+  size_t heapBytes;
+  size_t docBytes;
+  double micros;
+  char description[48];
+  float temperature;
+  float humidity;
+  float pressure;
+};
+
+static void readFields(JsonDocument& doc, ParseResult& result) {
+  snprintf(result.description, sizeof(result.description), "%s", doc["weather"][0]["description"] | "");
+  result.temperature = doc["main"]["temp"];
+  result.humidity = doc["main"]["humidity"];
+  result.pressure = doc["main"]["pressure"];
+}
+
+// Старий шлях: копія тіла в купу, потім повний розбір
+static ParseResult parseCopy(const std::string& body) {
+  ParseResult result = {};
+  size_t base = heapNow;
+  heapMark();
+  auto start = std::chrono::steady_clock::now();
+
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    std::string payload(body.data(), body.size());  // http.getString()
+    StaticJsonDocument<OLD_DOC_BYTES * SLOT_SCALE> doc;
+    DeserializationError error = deserializeJson(doc, payload);
+    if (round == 0) {
+      result.ok = !error;
+      result.docBytes = doc.memoryUsage();
+      if (!error) readFields(doc, result);
+    }
+  }
+
+  result.micros = std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - start).count() / BENCH_ROUNDS;
+  result.heapBytes = heapUsedSinceMark(base);
+  return result;
+}
+
+// Новий шлях: розбір прямо з потоку тим кодом, що на платі
+static ParseResult parseStream(const std::string& body) {
+  ParseResult result = {};
+  size_t base = heapNow;
+  heapMark();
+  auto start = std::chrono::steady_clock::now();
+
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    MemoryStream stream(body.data(), body.size());
+    WeatherData data;
+    bool ok = parseWeather(stream, data);
+    if (round == 0) {
+      result.ok = ok;
+      result.docBytes = WEATHER_DOC_BYTES;
+      snprintf(result.description, sizeof(result.description), "%s", data.description);
+      result.temperature = data.temperature;
+      result.humidity = data.humidity;
+      result.pressure = data.pressure;
+    }
+  }
+
+  result.micros = std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - start).count() / BENCH_ROUNDS;
+  result.heapBytes = heapUsedSinceMark(base);
+  return result;
+}
+
+static bool loadFile(const std::string& path, std::string& out) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) return false;
+  char chunk[512];
+  size_t got;
+  while ((got = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    out.append(chunk, got);
+  }
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  std::string dir = argc > 1 ? argv[1] : "data";
+
+  printf("%-20s %6s | %-8s %7s %6s %8s | %-8s %7s %6s %8s\n",
+         "payload", "bytes",
+         "copy", "heap", "doc", "us",
+         "stream", "heap", "cap", "us");
+
+  for (const char* name : PAYLOADS) {
+    std::string body;
+    if (!loadFile(dir + "/" + name, body)) {
+      printf("%s: cannot read\n", name);
+      checkFailures++;
+      continue;
+    }
+
+    ParseResult copy = parseCopy(body);
+    ParseResult stream = parseStream(body);
+
+    printf("%-20s %6zu | %-8s %7zu %6zu %8.1f | %-8s %7zu %6zu %8.1f\n",
+           name, body.size(),
+           copy.ok ? "ok" : "NoMemory", copy.heapBytes, copy.docBytes, copy.micros,
+           stream.ok ? "ok" : "error", stream.heapBytes, stream.docBytes, stream.micros);
+
+    // Потоковий шлях не чіпає купу і завжди вміщується у WEATHER_DOC_BYTES
+    CHECK(stream.ok);
+    CHECK_EQ(stream.heapBytes, 0);
+    CHECK(stream.description[0] != '\0');
+    CHECK(strcmp(stream.description, "No data") != 0);
+    CHECK(stream.pressure > 900 && stream.pressure < 1100);
+
+    // Там, де старий шлях встигав, результат той самий
+    if (copy.ok) {
+      CHECK(strcmp(copy.description, stream.description) == 0);
+      CHECK(copy.temperature == stream.temperature);
+      CHECK(copy.humidity == stream.humidity);
+      CHECK(copy.pressure == stream.pressure);
+    }
+  }
+
+  return checkResult("weather parse");
+}
\ No newline at end of file
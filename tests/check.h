@@ -0,0 +1,33 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+// ============= МІНІМАЛЬНІ ПЕРЕВІРКИ =============
+// Без фреймворку: помилка друкується і рахується, тест іде далі,
+// код виходу - кількість невдалих перевірок (0 для ctest - успіх).
+
+static int checkFailures = 0;
+
+#define CHECK(cond) do { \
+  if (!(cond)) { \
+    printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    checkFailures++; \
+  } \
+} while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+  long long checkA = (long long)(actual); \
+  long long checkE = (long long)(expected); \
+  if (checkA != checkE) { \
+    printf("%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, checkA, checkE); \
+    checkFailures++; \
+  } \
+} while (0)
+
+static inline int checkResult(const char* name) {
+  printf("%s: %s\n", name, checkFailures ? "FAILED" : "ok");
+  return checkFailures;
+}
+
+#endif // TEST_CHECK_H
\ No newline at end of file
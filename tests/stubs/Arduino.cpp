@@ -0,0 +1,71 @@
+#include "Arduino.h"
+
+// ============= ЗАГЛУШКИ FREERTOS =============
+// Задача не створюється, черга завжди порожня, семафор завжди вільний:
+// тестам вистачає синхронних частин модулів. З замороженим годинником
+// очікування не спить, а просуває годинник.
+
+void vTaskDelay(TickType_t ticks) {
+  if (stubClockFrozen) {
+    stubAdvanceMillis(ticks);
+    return;
+  }
+  usleep(ticks * 1000);
+}
+
+TickType_t xTaskGetTickCount() {
+  return millis();
+}
+
+BaseType_t xTaskCreate(void (*)(void*), const char*, uint32_t, void*, int, TaskHandle_t* handle) {
+  if (handle) *handle = NULL;
+  return pdFALSE;
+}
+
+void vTaskDelete(TaskHandle_t) {
+}
+
+QueueHandle_t xQueueCreate(uint32_t, uint32_t) {
+  return NULL;
+}
+
+BaseType_t xQueueSend(QueueHandle_t, const void*, TickType_t) {
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t, void*, TickType_t) {
+  return pdFALSE;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return NULL;
+}
+
+void xTaskNotifyGive(TaskHandle_t) {
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+}
+
+// Нотифікацій ніхто не шле: очікування завжди до таймауту
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t wait) {
+  vTaskDelay(wait);
+  return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return NULL;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return NULL;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t) {
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) {
+  return pdTRUE;
+}
\ No newline at end of file
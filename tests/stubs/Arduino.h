@@ -0,0 +1,128 @@
+#ifndef TEST_ARDUINO_STUB_H
+#define TEST_ARDUINO_STUB_H
+
+// ============= ЗАМІННИК ЯДРА ARDUINO ДЛЯ ПК =============
+// Лише те, що беруть модулі під тестом: String, Stream, час і FreeRTOS, який на
+// ESP32 приходить разом з Arduino.h. Черги й задачі FreeRTOS тут -
+// заглушки: тести викликають модулі з одного потоку.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using std::min;
+using std::max;
+
+// Тести з власним годинником заморожують час і рухають його самі,
+// напр. щоб перевірити переповнення millis()
+inline bool stubClockFrozen = false;
+inline uint64_t stubClockMicros = 0;
+
+inline void stubSetMillis(uint32_t ms) {
+  stubClockFrozen = true;
+  stubClockMicros = (uint64_t)ms * 1000;
+}
+
+inline void stubAdvanceMillis(uint32_t ms) {
+  stubClockMicros += (uint64_t)ms * 1000;
+}
+
+inline uint32_t micros() {
+  if (stubClockFrozen) return (uint32_t)stubClockMicros;
+  static const auto start = std::chrono::steady_clock::now();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint32_t millis() {
+  if (stubClockFrozen) return (uint32_t)(stubClockMicros / 1000);
+  return micros() / 1000;
+}
+
+#define IRAM_ATTR
+
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t length = strlen(src);
+  if (size > 0) {
+    size_t copy = length < size - 1 ? length : size - 1;
+    memcpy(dst, src, copy);
+    dst[copy] = '\0';
+  }
+  return length;
+}
+
+// ============= FREERTOS =============
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) (ms)
+
+// Визначення - в Arduino.cpp: тіла не видно компілятору, як і на платі
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+BaseType_t xTaskCreate(void (*entry)(void*), const char* name, uint32_t stack, void* arg,
+                       int priority, TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);
+QueueHandle_t xQueueCreate(uint32_t length, uint32_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+#define portYIELD_FROM_ISR()
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait);
+
+class String {
+private:
+  std::string text;
+
+public:
+  String() {}
+  String(const char* value) : text(value) {}
+
+  void reserve(size_t size) { text.reserve(size); }
+  String& operator+=(char c) { text += c; return *this; }
+  String& operator+=(const char* value) { text += value; return *this; }
+  bool operator==(const char* value) const { return text == value; }
+  const char* c_str() const { return text.c_str(); }
+  size_t length() const { return text.size(); }
+};
+
+// Потік лише для читання, як WiFiClient під HTTPClient::getStream();
+// ArduinoJson читає його через readBytes()
+class Stream {
+public:
+  virtual ~Stream() {}
+  virtual int available() = 0;
+  virtual int read() = 0;
+
+  size_t readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+      int c = read();
+      if (c < 0) break;
+      buffer[count++] = (char)c;
+    }
+    return count;
+  }
+};
+
+#endif // TEST_ARDUINO_STUB_H
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef TEST_HTTPCLIENT_STUB_H
+#define TEST_HTTPCLIENT_STUB_H
+
+// Мережі на ПК немає: GET() завжди невдалий, відповідь не читається.
+// Розбір відповіді перевіряється напряму через parseWeather().
+
+#include "Arduino.h"
+
+#define HTTP_CODE_OK 200
+
+class HTTPClient {
+private:
+  class EmptyStream : public Stream {
+  public:
+    int available() override { return 0; }
+    int read() override { return -1; }
+  };
+
+  EmptyStream stream;
+
+public:
+  void useHTTP10(bool) {}
+  bool begin(const String&) { return true; }
+  void setTimeout(uint16_t) {}
+  int GET() { return -1; }
+  Stream& getStream() { return stream; }
+  int getSize() { return -1; }
+  void end() {}
+};
+
+#endif // TEST_HTTPCLIENT_STUB_H
\ No newline at end of file
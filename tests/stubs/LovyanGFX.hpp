@@ -0,0 +1,77 @@
+#ifndef TEST_LOVYANGFX_STUB_H
+#define TEST_LOVYANGFX_STUB_H
+
+// ============= ЗАМІННИК LOVYANGFX ДЛЯ ПК =============
+// Полотно SCREEN_WIDTH x SCREEN_HEIGHT з кліпом: примітиви, якими малює
+// графік, пишуть пікселі, текст і бітмапи лише приймаються.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace lgfx {
+
+class LovyanGFX {
+public:
+  static const int WIDTH = 240;
+  static const int HEIGHT = 240;
+
+  std::vector<int32_t> pixels;   // -1 - ще не малювали
+  int clipX, clipY, clipW, clipH;
+
+  LovyanGFX() : pixels(WIDTH * HEIGHT, -1) { clearClipRect(); }
+  virtual ~LovyanGFX() {}
+
+  int32_t pixel(int x, int y) const { return pixels[y * WIDTH + x]; }
+
+  void setClipRect(int x, int y, int w, int h) {
+    clipX = x;
+    clipY = y;
+    clipW = w;
+    clipH = h;
+  }
+  void clearClipRect() { setClipRect(0, 0, WIDTH, HEIGHT); }
+
+  void drawPixel(int x, int y, uint32_t color) {
+    if (x < clipX || y < clipY || x >= clipX + clipW || y >= clipY + clipH) return;
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return;
+    pixels[y * WIDTH + x] = (int32_t)color;
+  }
+  void drawFastVLine(int x, int y, int h, uint32_t color) {
+    for (int i = 0; i < h; i++) drawPixel(x, y + i, color);
+  }
+  void fillRect(int x, int y, int w, int h, uint32_t color) {
+    for (int j = 0; j < h; j++) {
+      for (int i = 0; i < w; i++) drawPixel(x + i, y + j, color);
+    }
+  }
+
+  void drawRect(int, int, int, int, uint32_t) {}
+  void fillTriangle(int, int, int, int, int, int, uint32_t) {}
+  void drawBitmap(int, int, const uint8_t*, int, int, uint32_t) {}
+  void setCursor(int, int) {}
+  void setTextColor(uint32_t) {}
+  void setTextSize(float) {}
+  size_t print(const char*) { return 0; }
+  size_t print(char) { return 0; }
+
+  void startWrite() {}
+  void endWrite() {}
+  void writeCommand(uint8_t) {}
+  void writeData(uint8_t) {}
+};
+
+}  // namespace lgfx
+
+class LGFX_Sprite : public lgfx::LovyanGFX {
+public:
+  void setColorDepth(int) {}
+  void* createSprite(int, int) { return pixels.data(); }
+  bool createPalette() { return true; }
+  void setPaletteColor(size_t, uint8_t, uint8_t, uint8_t) {}
+  void fillSprite(uint32_t color) { fillRect(0, 0, WIDTH, HEIGHT, color); }
+  void* getBuffer() { return pixels.data(); }
+  void pushSprite(int, int) {}
+};
+
+#endif // TEST_LOVYANGFX_STUB_H
\ No newline at end of file
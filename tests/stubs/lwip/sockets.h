@@ -0,0 +1,26 @@
+#ifndef TEST_LWIP_SOCKETS_STUB_H
+#define TEST_LWIP_SOCKETS_STUB_H
+
+// Сокети lwIP повторюють BSD-сокети, на ПК - прямо POSIX
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define lwip_socket      ::socket
+#define lwip_setsockopt  ::setsockopt
+#define lwip_bind        ::bind
+#define lwip_listen      ::listen
+#define lwip_accept      ::accept
+#define lwip_close       ::close
+#define lwip_fcntl       ::fcntl
+#define lwip_select      ::select
+#define lwip_recv        ::recv
+// Клієнт, що пішов, не повинен вбивати тест через SIGPIPE
+#define lwip_send(fd, data, size, flags) ::send(fd, data, size, (flags) | MSG_NOSIGNAL)
+
+#endif // TEST_LWIP_SOCKETS_STUB_H
\ No newline at end of file
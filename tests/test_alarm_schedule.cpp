@@ -0,0 +1,207 @@
+#include "check.h"
+#include "alarm_schedule.h"
+#include "config.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+
+// ============= РОЗКЛАД БУДИЛЬНИКІВ =============
+// Часовий пояс Києва: літній час з останньої неділі березня 03:00,
+// зимовий з останньої неділі жовтня 04:00, тож 03:00-04:00 того дня
+// проходить двічі (TZ_STRING з config.h). Розклад опитується щосекунди,
+// як у задачі UI.
+
+// Місцевий час; isdst -1 - хай визначить mktime()
+static uint32_t at(int year, int month, int day, int hour, int minute, int isdst = -1) {
+  struct tm t = {};
+  t.tm_year = year - 1900;
+  t.tm_mon = month - 1;
+  t.tm_mday = day;
+  t.tm_hour = hour;
+  t.tm_min = minute;
+  t.tm_isdst = isdst;
+  return (uint32_t)mktime(&t);
+}
+
+struct Fire {
+  uint32_t time;
+  uint8_t id;
+};
+
+// Опитування щосекунди з from до to; rebuildAt - момент, коли розклад
+// перераховується, як після стрибка годинника чи зміни будильника
+static std::vector<Fire> pollRange(AlarmSchedule& schedule, uint32_t from, uint32_t to,
+                                   uint32_t rebuildAt = 0) {
+  std::vector<Fire> fires;
+  for (uint32_t now = from; now < to; now++) {
+    if (now == rebuildAt) schedule.reschedule(now);
+    bool changed = false;
+    uint8_t id = schedule.poll(now, changed);
+    if (id != 0) fires.push_back({now, id});
+  }
+  return fires;
+}
+
+static void testRollover() {
+  AlarmRule daily = {1, 7, 0, ALARM_EVERY_DAY, ALARM_ENABLED};
+
+  CHECK_EQ(alarmNextFire(daily, at(2025, 1, 31, 8, 0)), at(2025, 2, 1, 7, 0));
+  CHECK_EQ(alarmNextFire(daily, at(2025, 4, 30, 7, 0)), at(2025, 5, 1, 7, 0));
+  CHECK_EQ(alarmNextFire(daily, at(2025, 12, 31, 7, 0)), at(2026, 1, 1, 7, 0));
+  CHECK_EQ(alarmNextFire(daily, at(2025, 12, 31, 6, 59)), at(2025, 12, 31, 7, 0));
+
+  // П'ятниця ввечері в кінці місяця - понеділок наступного
+  AlarmRule weekdays = {2, 6, 30, ALARM_WEEKDAYS, ALARM_ENABLED};
+  CHECK_EQ(alarmNextFire(weekdays, at(2025, 10, 31, 20, 0)), at(2025, 11, 3, 6, 30));
+  // Середа 31 грудня 2025 -> четвер 1 січня 2026
+  CHECK_EQ(alarmNextFire(weekdays, at(2025, 12, 31, 7, 0)), at(2026, 1, 1, 6, 30));
+
+  AlarmSchedule schedule;
+  uint8_t id = schedule.add(0, 7, 0, ALARM_EVERY_DAY, true, at(2025, 12, 30, 12, 0));
+  std::vector<Fire> fires = pollRange(schedule, at(2025, 12, 30, 12, 0), at(2026, 1, 2, 0, 0));
+  CHECK_EQ(fires.size(), 2);
+  CHECK(fires.size() == 2 && fires[0].time == at(2025, 12, 31, 7, 0) && fires[0].id == id);
+  CHECK(fires.size() == 2 && fires[1].time == at(2026, 1, 1, 7, 0));
+}
+
+static void testLeapDay() {
+  AlarmRule daily = {1, 7, 0, ALARM_EVERY_DAY, ALARM_ENABLED};
+  CHECK_EQ(alarmNextFire(daily, at(2024, 2, 28, 9, 0)), at(2024, 2, 29, 7, 0));
+  CHECK_EQ(alarmNextFire(daily, at(2024, 2, 29, 9, 0)), at(2024, 3, 1, 7, 0));
+  CHECK_EQ(alarmNextFire(daily, at(2025, 2, 28, 9, 0)), at(2025, 3, 1, 7, 0));
+
+  // 29.02.2024 - четвер; у 2025-му наступний четвер після 27.02 - 6.03
+  AlarmRule thursday = {2, 8, 15, 1 << 4, ALARM_ENABLED};
+  CHECK_EQ(alarmNextFire(thursday, at(2024, 2, 23, 9, 0)), at(2024, 2, 29, 8, 15));
+  CHECK_EQ(alarmNextFire(thursday, at(2025, 2, 27, 9, 0)), at(2025, 3, 6, 8, 15));
+
+  AlarmSchedule schedule;
+  schedule.add(0, 8, 15, 1 << 4, true, at(2024, 2, 28, 0, 0));
+  std::vector<Fire> fires = pollRange(schedule, at(2024, 2, 28, 0, 0), at(2024, 3, 2, 0, 0));
+  CHECK_EQ(fires.size(), 1);
+  CHECK(fires.size() == 1 && fires[0].time == at(2024, 2, 29, 8, 15));
+}
+
+static void testSpringForward() {
+  // 30.03.2025 після 02:59:59 одразу 04:00: 03:30 немає
+  AlarmRule gap = {1, 3, 30, ALARM_EVERY_DAY, ALARM_ENABLED};
+  uint32_t shifted = alarmNextFire(gap, at(2025, 3, 30, 1, 0));
+  CHECK(shifted >= at(2025, 3, 30, 4, 0) && shifted <= at(2025, 3, 30, 5, 0));
+  CHECK_EQ(alarmNextFire(gap, shifted, shifted), at(2025, 3, 31, 3, 30));
+
+  // Щоденний 07:00 - через 23 години
+  AlarmRule daily = {2, 7, 0, ALARM_EVERY_DAY, ALARM_ENABLED};
+  CHECK_EQ(alarmNextFire(daily, at(2025, 3, 29, 7, 0)) - at(2025, 3, 29, 7, 0), 23 * 3600);
+
+  AlarmSchedule schedule;
+  schedule.add(0, 3, 30, ALARM_EVERY_DAY, true, at(2025, 3, 29, 12, 0));
+  std::vector<Fire> fires = pollRange(schedule, at(2025, 3, 29, 12, 0), at(2025, 4, 1, 0, 0));
+  CHECK_EQ(fires.size(), 2);
+  CHECK(fires.size() == 2 && fires[0].time == shifted);
+  CHECK(fires.size() == 2 && fires[1].time == at(2025, 3, 31, 3, 30));
+}
+
+static void testAutumnRepeat() {
+  // 26.10.2025 04:00 EEST -> 03:00 EET: 03:30 буває двічі, дзвонить раз
+  uint32_t firstPass = at(2025, 10, 26, 3, 30, 1);
+  uint32_t secondPass = at(2025, 10, 26, 3, 30, 0);
+  CHECK_EQ(secondPass - firstPass, 3600);
+
+  AlarmRule repeated = {1, 3, 30, ALARM_EVERY_DAY, ALARM_ENABLED};
+  uint32_t first = alarmNextFire(repeated, at(2025, 10, 26, 1, 0));
+  CHECK_EQ(first, firstPass);
+  CHECK_EQ(alarmNextFire(repeated, first, first), at(2025, 10, 27, 3, 30));
+  // Перерахунок о 03:10 EET, між проходами: спрацювання вже було
+  CHECK_EQ(alarmNextFire(repeated, at(2025, 10, 26, 3, 10, 0), first), at(2025, 10, 27, 3, 30));
+
+  // Щоденний 07:00 - через 25 годин
+  AlarmRule daily = {2, 7, 0, ALARM_EVERY_DAY, ALARM_ENABLED};
+  CHECK_EQ(alarmNextFire(daily, at(2025, 10, 25, 7, 0)) - at(2025, 10, 25, 7, 0), 25 * 3600);
+
+  uint32_t from = at(2025, 10, 25, 12, 0);
+  uint32_t to = at(2025, 10, 28, 0, 0);
+  uint32_t rebuild = at(2025, 10, 26, 3, 10, 0);
+
+  AlarmSchedule plain;
+  plain.add(0, 3, 30, ALARM_EVERY_DAY, true, from);
+  std::vector<Fire> fires = pollRange(plain, from, to);
+  CHECK_EQ(fires.size(), 2);
+  CHECK(fires.size() == 2 && fires[0].time == firstPass);
+  CHECK(fires.size() == 2 && fires[1].time == at(2025, 10, 27, 3, 30));
+
+  AlarmSchedule rebuilt;
+  rebuilt.add(0, 3, 30, ALARM_EVERY_DAY, true, from);
+  fires = pollRange(rebuilt, from, to, rebuild);
+  CHECK_EQ(fires.size(), 2);
+  CHECK(fires.size() == 2 && fires[0].time == firstPass);
+  CHECK(fires.size() == 2 && fires[1].time == at(2025, 10, 27, 3, 30));
+
+  // Вимкнути й увімкнути посеред повтору - теж без другого дзвінка
+  AlarmSchedule toggled;
+  uint8_t id = toggled.add(0, 3, 30, ALARM_EVERY_DAY, true, from);
+  fires = pollRange(toggled, from, rebuild);
+  CHECK_EQ(fires.size(), 1);
+  CHECK(toggled.update(id, false, false, rebuild));
+  CHECK(toggled.update(id, true, false, rebuild));
+  CHECK_EQ(toggled.getFireAt(0), at(2025, 10, 27, 3, 30));
+}
+
+// Купа, одноразовий, пропуск, відкладення, стрибок годинника
+static void testSchedule() {
+  AlarmSchedule schedule;
+  uint32_t now = at(2025, 5, 5, 6, 0);
+  bool changed = false;
+
+  uint8_t daily = schedule.add(0, 7, 0, ALARM_EVERY_DAY, true, now);
+  uint8_t once = schedule.add(0, 6, 30, 0, true, now);
+  uint8_t early = schedule.add(0, 6, 45, ALARM_EVERY_DAY, true, now);
+  CHECK(daily != 0 && once != 0 && early != 0);
+  CHECK(daily != once && once != early && daily != early);
+  CHECK_EQ(schedule.getDue(), at(2025, 5, 5, 6, 30));
+
+  CHECK_EQ(schedule.poll(at(2025, 5, 5, 6, 29), changed), 0);
+  CHECK_EQ(schedule.poll(at(2025, 5, 5, 6, 30), changed), once);
+  CHECK(changed);
+  CHECK(!(schedule[1].flags & ALARM_ENABLED));
+
+  CHECK(schedule.update(early, true, true, now));
+  CHECK_EQ(schedule.poll(at(2025, 5, 5, 6, 45), changed), 0);
+  CHECK(changed);
+  CHECK(!(schedule[2].flags & ALARM_SKIP_NEXT));
+  CHECK_EQ(schedule.poll(at(2025, 5, 5, 7, 0), changed), daily);
+  CHECK(!changed);
+
+  schedule.snooze(daily, at(2025, 5, 5, 7, 0), 540);
+  CHECK_EQ(schedule.getDue(), at(2025, 5, 5, 7, 9));
+  CHECK_EQ(schedule.poll(at(2025, 5, 5, 7, 9), changed), daily);
+  CHECK_EQ(schedule.getDue(), at(2025, 5, 6, 6, 45));
+
+  CHECK(schedule.remove(early));
+  CHECK(!schedule.remove(early));
+  CHECK_EQ(schedule.getDue(), at(2025, 5, 6, 7, 0));
+
+  // Зайнятий id не дублюється; зарезервований - використовується
+  uint8_t reserved = schedule.reserveId();
+  CHECK(reserved != 0 && reserved != daily && reserved != once);
+  CHECK_EQ(schedule.add(reserved, 5, 0, ALARM_EVERY_DAY, true, now), reserved);
+  uint8_t clash = schedule.add(daily, 5, 10, ALARM_EVERY_DAY, true, now);
+  CHECK(clash != 0 && clash != daily);
+  CHECK_EQ(schedule.add(0, 24, 0, ALARM_EVERY_DAY, true, now), 0);
+
+  // Годинник стрибнув назад
+  schedule.reschedule(at(2025, 5, 1, 0, 0));
+  CHECK_EQ(schedule.getDue(), at(2025, 5, 1, 5, 0));
+}
+
+int main() {
+  setenv("TZ", TZ_STRING, 1);
+  tzset();
+
+  testRollover();
+  testLeapDay();
+  testSpringForward();
+  testAutumnRepeat();
+  testSchedule();
+  return checkResult("alarm schedule");
+}
\ No newline at end of file
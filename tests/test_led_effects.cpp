@@ -0,0 +1,186 @@
+#include "check.h"
+#include "led_effects.h"
+
+#include <vector>
+
+// ============= РУШІЙ ЕФЕКТІВ З МАКЕТОМ БЕКЕНДА =============
+// Макет лише записує виклики; завершення фази імітує тест викликом
+// onFadeDone(), як це робить переривання LEDC на платі.
+
+struct LedCall {
+  bool fade;
+  uint8_t channel;
+  uint16_t duty;
+  uint16_t ms;
+};
+
+class MockBackend : public LedBackend {
+public:
+  std::vector<LedCall> calls;
+
+  void setDuty(uint8_t channel, uint16_t duty) override {
+    calls.push_back({false, channel, duty, 0});
+  }
+
+  void fade(uint8_t channel, uint16_t duty, uint16_t ms) override {
+    calls.push_back({true, channel, duty, ms});
+  }
+
+  // Забирає записані виклики, щоб кожна перевірка бачила лише нові
+  std::vector<LedCall> take() {
+    std::vector<LedCall> out;
+    out.swap(calls);
+    return out;
+  }
+};
+
+static bool isFade(const std::vector<LedCall>& calls, uint8_t channel, uint16_t duty, uint16_t ms) {
+  return calls.size() == 1 && calls[0].fade && calls[0].channel == channel &&
+         calls[0].duty == duty && calls[0].ms == ms;
+}
+
+static bool isJump(const std::vector<LedCall>& calls, uint8_t channel, uint16_t duty) {
+  return calls.size() == 1 && !calls[0].fade && calls[0].channel == channel && calls[0].duty == duty;
+}
+
+// Фаза закінчилась у бекенді, далі - черговий service() з loop()
+static bool finishFade(LedEngine& engine, uint8_t channel) {
+  engine.onFadeDone(channel);
+  return engine.service();
+}
+
+static void testSteady() {
+  MockBackend backend;
+  LedEngine engine(&backend);
+
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_STEADY, 1000, 200, 0});
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 1000, 200));
+  CHECK(engine.isRunning(LED_CHANNEL_WHITE));
+
+  // Без події від бекенда service нічого не запускає
+  CHECK(engine.service());
+  CHECK(backend.take().empty());
+
+  CHECK(!finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(backend.take().empty());
+  CHECK(!engine.isRunning(LED_CHANNEL_WHITE));
+  CHECK_EQ(engine.getDuty(LED_CHANNEL_WHITE), 1000);
+
+  // Той самий рівень - жодного виклику; нульовий період - стрибок
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_STEADY, 1000, 200, 0});
+  CHECK(backend.take().empty());
+  CHECK(!engine.isRunning(LED_CHANNEL_WHITE));
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_STEADY, 10, 0, 0});
+  CHECK(isJump(backend.take(), LED_CHANNEL_WHITE, 10));
+  CHECK(!engine.service());
+}
+
+static void testBreathe() {
+  MockBackend backend;
+  LedEngine engine(&backend);
+
+  engine.play(LED_CHANNEL_YELLOW, {LED_EFFECT_BREATHE, 800, 500, 0});
+  CHECK(isFade(backend.take(), LED_CHANNEL_YELLOW, 800, 500));
+  for (int cycle = 0; cycle < 3; cycle++) {
+    CHECK(finishFade(engine, LED_CHANNEL_YELLOW));
+    CHECK(isFade(backend.take(), LED_CHANNEL_YELLOW, 0, 500));
+    CHECK(finishFade(engine, LED_CHANNEL_YELLOW));
+    CHECK(isFade(backend.take(), LED_CHANNEL_YELLOW, 800, 500));
+  }
+
+  // Дихання стрибками вироджується в постійний рівень
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_BREATHE, 300, 0, 0});
+  CHECK(isJump(backend.take(), LED_CHANNEL_WHITE, 300));
+  CHECK(!engine.isRunning(LED_CHANNEL_WHITE));
+}
+
+static void testBlink() {
+  MockBackend backend;
+  LedEngine engine(&backend);
+
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_STEADY, 300, 0, 0});
+  CHECK(isJump(backend.take(), LED_CHANNEL_WHITE, 300));
+
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_BLINK, 1000, 100, 2});
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 1000, 100));
+  CHECK(finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 0, 100));
+  CHECK(finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 1000, 100));
+  CHECK(finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 0, 100));
+
+  // Після спалахів - стрибком назад до рівня спокою, і ефект завершено
+  CHECK(!finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isJump(backend.take(), LED_CHANNEL_WHITE, 300));
+  CHECK(!engine.isRunning(LED_CHANNEL_WHITE));
+}
+
+static void testRestLevelDuringBlink() {
+  MockBackend backend;
+  LedEngine engine(&backend);
+
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_BLINK, 1000, 100, 1});
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 1000, 100));
+
+  // Нічний режим змінився посеред спалаху: лише запам'ятати
+  engine.setRestLevel(LED_CHANNEL_WHITE, 500, 200);
+  CHECK(backend.take().empty());
+  engine.setRestLevel(LED_CHANNEL_WHITE, 40, 200);
+  CHECK(backend.take().empty());
+
+  CHECK(finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 0, 100));
+  CHECK(!finishFade(engine, LED_CHANNEL_WHITE));
+  CHECK(isJump(backend.take(), LED_CHANNEL_WHITE, 40));
+
+  // Без спалахів setRestLevel - звичайний плавний перехід
+  engine.setRestLevel(LED_CHANNEL_WHITE, 500, 200);
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 500, 200));
+}
+
+static void testFadeDoneOrdering() {
+  MockBackend backend;
+  LedEngine engine(&backend);
+
+  engine.play(LED_CHANNEL_WHITE, {LED_EFFECT_BREATHE, 800, 500, 0});
+  engine.play(LED_CHANNEL_YELLOW, {LED_EFFECT_STEADY, 600, 300, 0});
+  backend.take();
+
+  // onFadeDone з переривання лише ставить прапорець, бекенд не чіпає
+  engine.onFadeDone(LED_CHANNEL_WHITE);
+  CHECK(backend.take().empty());
+
+  // Новий ефект під час фази чекає її кінця, а не обриває її
+  engine.play(LED_CHANNEL_YELLOW, {LED_EFFECT_STEADY, 100, 300, 0});
+  CHECK(backend.take().empty());
+
+  // service просуває лише канал з подією, і лише один раз
+  CHECK(engine.service());
+  CHECK(isFade(backend.take(), LED_CHANNEL_WHITE, 0, 500));
+  CHECK(engine.service());
+  CHECK(backend.take().empty());
+
+  // Кінець старої фази запускає відкладений ефект
+  CHECK(finishFade(engine, LED_CHANNEL_YELLOW));
+  CHECK(isFade(backend.take(), LED_CHANNEL_YELLOW, 100, 300));
+  CHECK_EQ(engine.getDuty(LED_CHANNEL_YELLOW), 100);
+
+  // Дві події до одного service - обидва канали просуваються
+  engine.onFadeDone(LED_CHANNEL_WHITE);
+  engine.onFadeDone(LED_CHANNEL_YELLOW);
+  CHECK(engine.service());
+  std::vector<LedCall> calls = backend.take();
+  CHECK_EQ(calls.size(), 1);
+  CHECK(calls.size() == 1 && calls[0].channel == LED_CHANNEL_WHITE && calls[0].duty == 800);
+  CHECK(!engine.isRunning(LED_CHANNEL_YELLOW));
+}
+
+int main() {
+  testSteady();
+  testBreathe();
+  testBlink();
+  testRestLevelDuringBlink();
+  testFadeDoneOrdering();
+  return checkResult("led effects");
+}
\ No newline at end of file
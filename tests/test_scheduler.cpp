@@ -0,0 +1,83 @@
+#include "check.h"
+#include "scheduler.h"
+
+#include <vector>
+
+// ============= ПЛАНУВАЛЬНИК ЧЕРЕЗ ПЕРЕПОВНЕННЯ MILLIS() =============
+// Годинник заглушки заморожено за кілька секунд до переповнення
+// millis(); сон у run() просуває його на час очікування, тож хвилина
+// роботи проганяється миттєво.
+
+#define RUN_SECONDS 60
+#define LONG_JOB_MS 20000   // довше за оберт колеса
+
+static std::vector<uint32_t> clockRuns;
+static std::vector<uint32_t> fastRuns;
+static std::vector<uint32_t> longRuns;
+
+static uint32_t clockJob() {
+  clockRuns.push_back(millis());
+  return 1000;
+}
+
+static uint32_t fastJob() {
+  fastRuns.push_back(millis());
+  return 100;
+}
+
+static uint32_t longJob() {
+  longRuns.push_back(millis());
+  return LONG_JOB_MS;
+}
+
+// Інтервали між запусками в межах [period, period + тік]
+static bool periodic(const std::vector<uint32_t>& runs, uint32_t period) {
+  for (size_t i = 1; i < runs.size(); i++) {
+    uint32_t interval = runs[i] - runs[i - 1];
+    if (interval < period || interval > period + SCHEDULER_TICK_MS) {
+      printf("interval %u after run %zu, expected %u\n", interval, i, period);
+      return false;
+    }
+  }
+  return true;
+}
+
+static void runFrom(uint32_t startMs) {
+  clockRuns.clear();
+  fastRuns.clear();
+  longRuns.clear();
+  stubSetMillis(startMs);
+
+  static Scheduler* scheduler;
+  delete scheduler;
+  scheduler = new Scheduler();
+  scheduler->begin();
+  scheduler->add("clock", clockJob, 2, 0, 0);
+  scheduler->add("fast", fastJob, 1, 0, 0);
+  scheduler->add("long", longJob, 0, 0, LONG_JOB_MS);
+
+  uint32_t start = millis();
+  uint32_t passes = 0;
+  while (millis() - start < RUN_SECONDS * 1000UL && passes < 1000000) {
+    scheduler->run();
+    passes++;
+  }
+
+  CHECK(clockRuns.size() >= RUN_SECONDS && clockRuns.size() <= RUN_SECONDS + 1);
+  CHECK(fastRuns.size() >= RUN_SECONDS * 10 - 5 && fastRuns.size() <= RUN_SECONDS * 10 + 1);
+  CHECK_EQ(longRuns.size(), RUN_SECONDS * 1000UL / LONG_JOB_MS - 1);
+  CHECK(periodic(clockRuns, 1000));
+  CHECK(periodic(fastRuns, 100));
+  CHECK(periodic(longRuns, LONG_JOB_MS));
+  // Сон до дедлайну, а не пробудження щотіку
+  CHECK(passes < fastRuns.size() * 3);
+}
+
+int main() {
+  // Звичайний старт і старт за 3 с до переповнення millis()
+  runFrom(1000);
+  runFrom(UINT32_MAX - 3000);
+  // Переповнення посеред довгого очікування
+  runFrom(UINT32_MAX - LONG_JOB_MS / 2);
+  return checkResult("scheduler");
+}
\ No newline at end of file
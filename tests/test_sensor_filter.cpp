@@ -0,0 +1,80 @@
+#include "check.h"
+#include "sensor_filter.h"
+
+// ============= МЕДІАННИЙ ФІЛЬТР ДАТЧИКА =============
+// Вибірки подаються по одній, як із задачі датчика; медіана береться
+// після кожної.
+
+static SensorSample sample(float pressurePa, float temperature, uint32_t timestamp) {
+  SensorSample s;
+  s.pressurePa = pressurePa;
+  s.temperature = temperature;
+  s.timestamp = timestamp;
+  return s;
+}
+
+// Поки вікно не заповнене, медіана - з наявних вибірок
+static void testPartialWindow() {
+  SensorFilter filter;
+  CHECK_EQ(filter.size(), 0);
+
+  filter.add(sample(100000, 20.0f, 1000));
+  CHECK_EQ(filter.size(), 1);
+  CHECK_EQ(filter.median().pressurePa, 100000);
+  CHECK_EQ(filter.median().timestamp, 1000);
+
+  // Дві вибірки - верхня з двох
+  filter.add(sample(99900, 21.0f, 2000));
+  CHECK_EQ(filter.median().pressurePa, 100000);
+  CHECK_EQ(filter.median().temperature, 21.0f);
+
+  filter.add(sample(99950, 19.0f, 3000));
+  CHECK_EQ(filter.size(), 3);
+  CHECK_EQ(filter.median().pressurePa, 99950);
+  CHECK_EQ(filter.median().temperature, 20.0f);
+  CHECK_EQ(filter.median().timestamp, 3000);
+}
+
+// Поодинокий збій не виходить з фільтра ні вгору, ні вниз
+static void testOutlier() {
+  SensorFilter filter;
+  const float steady[] = {101300, 101302, 101298, 101301, 101299};
+  for (uint32_t i = 0; i < 5; i++) {
+    filter.add(sample(steady[i], 22.0f, i));
+  }
+  CHECK_EQ(filter.median().pressurePa, 101300);
+
+  // Збій витісняє 101300: медіана - сусіднє значення, а не 30000
+  filter.add(sample(30000, 22.0f, 5));
+  CHECK_EQ(filter.median().pressurePa, 101299);
+  CHECK_EQ(filter.median().timestamp, 5);
+
+  filter.add(sample(101300, 85.0f, 6));
+  CHECK_EQ(filter.median().pressurePa, 101299);
+  CHECK_EQ(filter.median().temperature, 22.0f);
+
+  // Навіть два збої з п'яти ще не дають медіані зрушити
+  filter.add(sample(200000, 22.0f, 7));
+  CHECK(filter.median().pressurePa > 101290 && filter.median().pressurePa < 101310);
+}
+
+// Після кількох обертів кільця медіана - лише з останніх SENSOR_MEDIAN_WINDOW
+static void testWrapAround() {
+  SensorFilter filter;
+  for (uint32_t i = 0; i < 4 * SENSOR_MEDIAN_WINDOW + 2; i++) {
+    filter.add(sample(100000 + i, (float)i, 1000 * i));
+    if (i + 1 < SENSOR_MEDIAN_WINDOW) continue;
+
+    CHECK_EQ(filter.size(), SENSOR_MEDIAN_WINDOW);
+    CHECK_EQ(filter.median().pressurePa, 100000 + i - SENSOR_MEDIAN_WINDOW / 2);
+    CHECK_EQ(filter.median().temperature, (float)(i - SENSOR_MEDIAN_WINDOW / 2));
+    CHECK_EQ(filter.median().timestamp, 1000 * i);
+  }
+}
+
+int main() {
+  testPartialWindow();
+  testOutlier();
+  testWrapAround();
+  return checkResult("sensor_filter");
+}
\ No newline at end of file
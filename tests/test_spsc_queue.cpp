@@ -0,0 +1,102 @@
+#include "check.h"
+#include "spsc_queue.h"
+
+#include <thread>
+
+// ============= СТРЕС-ТЕСТ SPSC-ЧЕРГИ =============
+// Один потік-виробник і один споживач, як задача мережі та задача UI.
+// Кожен елемент несе номер і похідне від нього значення: пропуск,
+// повтор, перестановка чи наполовину записаний елемент видно одразу.
+
+#define STRESS_ITEMS 1000000u
+#define QUEUE_SIZE   16
+
+struct Item {
+  uint32_t seq;
+  uint32_t check;
+};
+
+static uint32_t checkOf(uint32_t seq) {
+  return seq * 2654435761u ^ 0xA5A5A5A5u;
+}
+
+// Межі в одному потоці: повна, порожня, порядок після переходу через край
+static void testEdges() {
+  SpscQueue<Item, QUEUE_SIZE> queue;
+  Item item = {};
+
+  CHECK(queue.isEmpty());
+  CHECK(!queue.pop(item));
+
+  for (uint32_t i = 0; i < QUEUE_SIZE; i++) {
+    CHECK(queue.push({i, checkOf(i)}));
+  }
+  CHECK_EQ(queue.size(), QUEUE_SIZE);
+  CHECK(!queue.push({99, 0}));
+  CHECK_EQ(queue.getDropped(), 1);
+
+  // Звільнене місце знову доступне, індекс переходить через кінець буфера
+  CHECK(queue.pop(item));
+  CHECK_EQ(item.seq, 0);
+  CHECK(queue.push({QUEUE_SIZE, checkOf(QUEUE_SIZE)}));
+  CHECK(!queue.push({99, 0}));
+  CHECK_EQ(queue.getDropped(), 2);
+
+  for (uint32_t i = 1; i <= QUEUE_SIZE; i++) {
+    CHECK(queue.pop(item));
+    CHECK_EQ(item.seq, i);
+    CHECK_EQ(item.check, checkOf(i));
+  }
+  CHECK(queue.isEmpty());
+  CHECK_EQ(queue.size(), 0);
+  CHECK(!queue.pop(item));
+}
+
+static void testStress() {
+  static SpscQueue<Item, QUEUE_SIZE> queue;
+  uint32_t received = 0;
+  uint32_t outOfOrder = 0;
+  uint32_t corrupted = 0;
+  uint32_t maxSize = 0;
+
+  // Виробник повторює push, доки черга повна: нічого не губиться
+  std::thread producer([] {
+    for (uint32_t seq = 0; seq < STRESS_ITEMS; seq++) {
+      Item item = {seq, checkOf(seq)};
+      while (!queue.push(item)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::thread consumer([&] {
+    Item item;
+    while (received < STRESS_ITEMS) {
+      size_t size = queue.size();
+      if (size > maxSize) maxSize = size;
+      if (!queue.pop(item)) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (item.seq != received) outOfOrder++;
+      if (item.check != checkOf(item.seq)) corrupted++;
+      received++;
+    }
+  });
+
+  producer.join();
+  consumer.join();
+
+  CHECK_EQ(received, STRESS_ITEMS);
+  CHECK_EQ(outOfOrder, 0);
+  CHECK_EQ(corrupted, 0);
+  CHECK(maxSize <= QUEUE_SIZE);
+  CHECK(queue.isEmpty());
+  printf("spsc: %u items, %u full-queue retries\n", STRESS_ITEMS, queue.getDropped());
+}
+
+int main() {
+  testEdges();
+  testStress();
+  return checkResult("spsc queue");
+}
\ No newline at end of file
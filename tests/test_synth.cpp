@@ -0,0 +1,138 @@
+#include "check.h"
+#include "synth.h"
+
+#include <vector>
+
+// ============= ЕТАЛОН СИНТЕЗАТОРА =============
+// Синтезатор цілочисельний, тож вихід має збігатися побітово на будь-якій
+// платформі. Еталон знято з I2S_SAMPLE_RATE 16 кГц блоками по 256 семплів;
+// якщо звук змінено свідомо - оновіть довжини, хеші та початок буфера.
+
+#define TEST_RATE  16000
+#define TEST_BLOCK 256
+
+// Початок BEEP: атака 5 мс на синусі 1 кГц (16 семплів на період)
+static const int16_t BEEP_HEAD[96] = {
+       0,     28,    106,    207,    299,    346,    318,    200,
+       0,   -259,   -531,   -763,   -900,   -901,   -743,   -431,
+       0,    487,    954,   1316,   1499,   1454,   1166,    659,
+       0,   -718,  -1379,  -1871,  -2100,  -2010,  -1592,   -890,
+       0,    947,   1802,   2424,   2699,   2563,   2015,   1119,
+       0,  -1177,  -2228,  -2980,  -3300,  -3118,  -2440,  -1349,
+       0,   1406,   2651,   3533,   3899,   3672,   2863,   1578,
+       0,  -1636,  -3076,  -4089,  -4500,  -4227,  -3288,  -1809,
+       0,   1865,   3499,   4642,   5099,   4780,   3712,   2037,
+       0,  -2096,  -3925,  -5197,  -5700,  -5336,  -4137,  -2268,
+       0,   2294,   4236,   5531,   5984,   5525,   4225,   2285,
+       0,  -2283,  -4216,  -5504,  -5954,  -5497,  -4205,  -2274,
+};
+
+#define BEEP_LOOPS       3
+#define BEEP_SAMPLES     67328
+#define BEEP_FNV         0xcbd35042u
+#define MELODY_LOOPS     2
+#define MELODY_SAMPLES   40192
+#define MELODY_FNV       0xf292ccbbu
+
+// FNV-1a по байтах little-endian, незалежно від порядку байтів ПК
+static uint32_t fnv1a(const std::vector<int16_t>& samples) {
+  uint32_t hash = 2166136261u;
+  for (int16_t sample : samples) {
+    uint16_t value = (uint16_t)sample;
+    hash = (hash ^ (value & 0xFF)) * 16777619u;
+    hash = (hash ^ (value >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+// Рендер до кінця патерну, як це робить задача звуку
+static std::vector<int16_t> renderAll(const SynthPattern* pattern, uint16_t loops, size_t block) {
+  Synth synth(TEST_RATE);
+  std::vector<int16_t> out;
+  std::vector<int16_t> buffer(block);
+
+  synth.start(pattern, loops);
+  while (synth.isActive()) {
+    synth.render(buffer.data(), block);
+    out.insert(out.end(), buffer.begin(), buffer.end());
+  }
+  return out;
+}
+
+static void testReference() {
+  std::vector<int16_t> beep = renderAll(&SYNTH_PATTERN_BEEP, BEEP_LOOPS, TEST_BLOCK);
+  CHECK_EQ(beep.size(), BEEP_SAMPLES);
+  CHECK_EQ(fnv1a(beep), BEEP_FNV);
+  for (size_t i = 0; i < sizeof(BEEP_HEAD) / sizeof(BEEP_HEAD[0]) && i < beep.size(); i++) {
+    CHECK_EQ(beep[i], BEEP_HEAD[i]);
+  }
+
+  std::vector<int16_t> melody = renderAll(&SYNTH_PATTERN_MELODY, MELODY_LOOPS, TEST_BLOCK);
+  CHECK_EQ(melody.size(), MELODY_SAMPLES);
+  CHECK_EQ(fnv1a(melody), MELODY_FNV);
+}
+
+// Межі блоків не впливають на сигнал: блок в 1 семпл дає той самий звук
+static void testBlockIndependence() {
+  std::vector<int16_t> large = renderAll(&SYNTH_PATTERN_MELODY, MELODY_LOOPS, TEST_BLOCK);
+  std::vector<int16_t> small = renderAll(&SYNTH_PATTERN_MELODY, MELODY_LOOPS, 1);
+
+  CHECK(small.size() <= large.size());
+  size_t mismatches = 0;
+  for (size_t i = 0; i < small.size(); i++) {
+    if (small[i] != large[i]) mismatches++;
+  }
+  CHECK_EQ(mismatches, 0);
+
+  // Хвіст великого блоку після кінця патерну - тиша
+  for (size_t i = small.size(); i < large.size(); i++) {
+    if (large[i] != 0) mismatches++;
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+// Після stop() і без патерну render дає нулі
+static void testSilence() {
+  Synth synth(TEST_RATE);
+  int16_t buffer[TEST_BLOCK];
+
+  for (size_t i = 0; i < TEST_BLOCK; i++) buffer[i] = 1;
+  CHECK_EQ(synth.render(buffer, TEST_BLOCK), 0);
+  for (size_t i = 0; i < TEST_BLOCK; i++) CHECK_EQ(buffer[i], 0);
+
+  synth.start(&SYNTH_PATTERN_BEEP, 1);
+  CHECK(synth.isActive());
+  synth.stop();
+  CHECK(!synth.isActive());
+  CHECK_EQ(synth.render(buffer, TEST_BLOCK), 0);
+}
+
+// Ноти нульової довжини пропускаються, патерн усе одно закінчується
+static void testZeroLengthNotes() {
+  static const SynthNote notes[] = {{1000, 0}, {1000, 10}, {0, 0}};
+  static const SynthPattern pattern = {notes, 3, {1, 2, 20000, 2}, {6000, 3000, 30000}};
+  static const SynthNote silent[] = {{1000, 0}, {0, 0}};
+  static const SynthPattern empty = {silent, 2, {1, 2, 20000, 2}, {6000, 3000, 30000}};
+
+  Synth synth(TEST_RATE);
+  int16_t buffer[TEST_BLOCK];
+  size_t total = 0;
+  synth.start(&pattern, 2);
+  for (int blocks = 0; synth.isActive() && blocks < 16; blocks++) {
+    total += synth.render(buffer, TEST_BLOCK);
+  }
+  CHECK(!synth.isActive());
+  CHECK_EQ(total, 2 * TEST_RATE * 10 / 1000);
+
+  synth.start(&empty, 3);
+  CHECK_EQ(synth.render(buffer, TEST_BLOCK), 0);
+  CHECK(!synth.isActive());
+}
+
+int main() {
+  testReference();
+  testBlockIndependence();
+  testSilence();
+  testZeroLengthNotes();
+  return checkResult("synth");
+}
\ No newline at end of file
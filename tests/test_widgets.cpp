@@ -0,0 +1,277 @@
+#include "check.h"
+#include "widgets.h"
+
+#include <deque>
+
+// ============= ГРАФІК ТИСКУ І ЕКРАН NATURE =============
+// Віджети проходять той самий шлях, що в Compositor::submit(): брудні
+// прямокутники збираються в DirtyRegion, байти на панель - площа * 2.
+// Кадр, перемальований лише в брудних прямокутниках, має збігатися
+// з кадром, намальованим з нуля.
+
+#define BG_COLOR    0
+#define LINE_COLOR  2
+#define FILL_COLOR  1
+#define GRAPH_Y     204
+#define COLUMN_BYTES (GRAPH_HEIGHT * 2)
+#define FULL_BYTES  (GRAPH_COLUMNS * GRAPH_HEIGHT * 2)
+
+static uint32_t regionBytes(const DirtyRegion& region) {
+  uint32_t bytes = 0;
+  for (uint8_t i = 0; i < region.size(); i++) {
+    bytes += (uint32_t)region[i].area() * 2;
+  }
+  return bytes;
+}
+
+static bool isFullGraph(const DirtyRegion& region) {
+  return region.size() == 1 && region[0].x == 0 && region[0].y == GRAPH_Y &&
+         region[0].w == GRAPH_COLUMNS && region[0].h == GRAPH_HEIGHT;
+}
+
+// Шкала як у GraphWidget::rescale(): межі кратні GRAPH_SCALE_STEP,
+// не вужче GRAPH_MIN_SPAN, по всіх колонках кільця
+class ScaleModel {
+private:
+  std::deque<uint16_t> columns;
+
+public:
+  uint16_t low;
+  uint16_t high;
+
+  ScaleModel() : columns(GRAPH_COLUMNS, 0), low(0), high(0) {}
+
+  // true - межі змінились
+  bool push(uint16_t value) {
+    columns.pop_front();
+    columns.push_back(value);
+
+    uint16_t minValue = UINT16_MAX;
+    uint16_t maxValue = 0;
+    for (uint16_t v : columns) {
+      if (v == 0) continue;
+      if (v < minValue) minValue = v;
+      if (v > maxValue) maxValue = v;
+    }
+    if (maxValue == 0) return false;
+
+    uint16_t newLow = minValue / GRAPH_SCALE_STEP * GRAPH_SCALE_STEP;
+    uint16_t newHigh = (maxValue + GRAPH_SCALE_STEP - 1) / GRAPH_SCALE_STEP * GRAPH_SCALE_STEP;
+    if (newHigh - newLow < GRAPH_MIN_SPAN) {
+      uint16_t below = (GRAPH_MIN_SPAN - (newHigh - newLow)) / GRAPH_SCALE_STEP / 2 * GRAPH_SCALE_STEP;
+      newLow = newLow > below ? newLow - below : 0;
+      newHigh = newLow + GRAPH_MIN_SPAN;
+    }
+    if (newLow == low && newHigh == high) return false;
+    low = newLow;
+    high = newHigh;
+    return true;
+  }
+};
+
+// Перемальовує брудні прямокутники, як renderRect() у композиторі
+static void renderDirty(lgfx::LovyanGFX& screen, Widget* const* widgets, size_t count,
+                        const DirtyRegion& region) {
+  for (uint8_t r = 0; r < region.size(); r++) {
+    const Rect& rect = region[r];
+    screen.setClipRect(rect.x, rect.y, rect.w, rect.h);
+    screen.fillRect(rect.x, rect.y, rect.w, rect.h, BG_COLOR);
+    for (size_t i = 0; i < count; i++) {
+      if (widgets[i]->getBounds().intersects(rect)) widgets[i]->draw(&screen, 0, 0);
+    }
+  }
+  screen.clearClipRect();
+}
+
+// Кадровий буфер після Compositor::begin() - залитий фоном
+static void clearScreen(lgfx::LovyanGFX& screen) {
+  screen.fillRect(0, 0, lgfx::LovyanGFX::WIDTH, lgfx::LovyanGFX::HEIGHT, BG_COLOR);
+}
+
+static bool sameAsFullRender(const lgfx::LovyanGFX& screen, Widget* const* widgets, size_t count) {
+  lgfx::LovyanGFX reference;
+  clearScreen(reference);
+  for (size_t i = 0; i < count; i++) widgets[i]->draw(&reference, 0, 0);
+  return reference.pixels == screen.pixels;
+}
+
+static uint16_t nextRandom(uint32_t& state) {
+  state = state * 1664525u + 1013904223u;
+  return (uint16_t)(state >> 16);
+}
+
+// Рівний тиск у межах шкали: кожне оновлення - дві колонки, включно
+// з переходом через правий край, де вони розпадаються на два вікна
+static void testSteadyColumns() {
+  GraphWidget graph(0, GRAPH_Y, GRAPH_HEIGHT, LINE_COLOR, FILL_COLOR);
+  Widget* widgets[] = {&graph};
+  lgfx::LovyanGFX screen;
+  clearScreen(screen);
+  DirtyRegion region;
+
+  graph.push(10125);
+  graph.addDirtyRects(region);
+  CHECK(isFullGraph(region));
+  renderDirty(screen, widgets, 1, region);
+  graph.clearDirty();
+
+  uint32_t wraps = 0;
+  for (uint32_t i = 1; i < 3 * GRAPH_COLUMNS; i++) {
+    graph.push(10120 + i % 10);
+    region.clear();
+    graph.addDirtyRects(region);
+
+    CHECK_EQ(regionBytes(region), 2 * COLUMN_BYTES);
+    CHECK(regionBytes(region) <= GRAPH_SPI_BUDGET);
+    // Нова колонка в останньому стовпці - порожня за нею вже в нульовому
+    if (i % GRAPH_COLUMNS == GRAPH_COLUMNS - 1) {
+      wraps++;
+      CHECK_EQ(region.size(), 2);
+      CHECK(region.size() == 2 && region[0].x == GRAPH_COLUMNS - 1 && region[0].w == 1);
+      CHECK(region.size() == 2 && region[1].x == 0 && region[1].w == 1);
+    } else {
+      CHECK_EQ(region.size(), 1);
+    }
+
+    renderDirty(screen, widgets, 1, region);
+    graph.clearDirty();
+  }
+  CHECK_EQ(wraps, 3);
+  CHECK(sameAsFullRender(screen, widgets, 1));
+}
+
+// Кілька колонок між кадрами: нові колонки і порожня, і вся площа,
+// коли пропущено майже все кільце
+static void testPendingColumns() {
+  GraphWidget graph(0, GRAPH_Y, GRAPH_HEIGHT, LINE_COLOR, FILL_COLOR);
+  DirtyRegion region;
+
+  graph.push(10125);
+  graph.clearDirty();
+
+  for (uint16_t pending = 1; pending < GRAPH_COLUMNS - 1; pending += 7) {
+    for (uint16_t i = 0; i < pending; i++) graph.push(10121 + i % 8);
+    region.clear();
+    graph.addDirtyRects(region);
+    uint32_t bytes = regionBytes(region);
+    // Два вікна через край можуть злитися, якщо так дешевше
+    CHECK(bytes >= (uint32_t)(pending + 1) * COLUMN_BYTES);
+    CHECK(bytes <= (uint32_t)(pending + 1) * COLUMN_BYTES + 256 * 2);
+    graph.clearDirty();
+  }
+
+  for (uint16_t i = 0; i < GRAPH_COLUMNS - 1; i++) graph.push(10125);
+  region.clear();
+  graph.addDirtyRects(region);
+  CHECK(isFullGraph(region));
+}
+
+// Довге випадкове блукання з пропусками: уся площа графіка - тоді й
+// лише тоді, коли змінилась шкала, і картинка лишається правильною
+static void testRescaleOnly() {
+  GraphWidget graph(0, GRAPH_Y, GRAPH_HEIGHT, LINE_COLOR, FILL_COLOR);
+  Widget* widgets[] = {&graph};
+  ScaleModel model;
+  lgfx::LovyanGFX screen;
+  clearScreen(screen);
+  DirtyRegion region;
+  uint32_t seed = 12345;
+  int32_t pressure = 10130;
+  uint32_t rescales = 0;
+  uint32_t fullRedraws = 0;
+
+  for (uint32_t i = 0; i < 20 * GRAPH_COLUMNS; i++) {
+    pressure += (int32_t)(nextRandom(seed) % 7) - 3;
+    if (pressure < 9500) pressure = 9500;
+    if (pressure > 10800) pressure = 10800;
+    uint16_t value = nextRandom(seed) % 50 == 0 ? 0 : (uint16_t)pressure;
+
+    graph.push(value);
+    bool rescaled = model.push(value);
+    region.clear();
+    graph.addDirtyRects(region);
+
+    bool full = isFullGraph(region);
+    CHECK_EQ(full, rescaled);
+    if (!full) CHECK_EQ(regionBytes(region), 2 * COLUMN_BYTES);
+    rescales += rescaled;
+    fullRedraws += full;
+
+    renderDirty(screen, widgets, 1, region);
+    graph.clearDirty();
+    if (i % 97 == 0) CHECK(sameAsFullRender(screen, widgets, 1));
+  }
+  CHECK(sameAsFullRender(screen, widgets, 1));
+  CHECK(rescales > 1);
+  printf("graph: %u columns, %u rescales, %u full redraws\n", 20 * GRAPH_COLUMNS, rescales, fullRedraws);
+}
+
+// Екран NATURE з розкладкою DisplayManager: після першого кадру щохвилинне
+// оновлення з тим самим текстом пише на панель лише колонки графіка
+static void testNatureScreen() {
+  ValueWidget descriptionValue(0, 90, 240, 16, 2, 2);
+  ValueWidget temperatureValue(0, 120, 160, 16, 2, 2);
+  ValueWidget pressureValue(0, 150, 160, 16, 2, 2);
+  ValueWidget roomTemperatureValue(164, 150, 76, 16, 2, 2);
+  ValueWidget humidityValue(0, 180, 100, 16, 2, 2);
+  BarWidget humidityBar(104, 182, 130, 12, 100, FILL_COLOR);
+  GraphWidget pressureGraph(0, GRAPH_Y, GRAPH_HEIGHT, LINE_COLOR, FILL_COLOR);
+  TrendWidget pressureTrend(208, GRAPH_Y, 24, GRAPH_HEIGHT, LINE_COLOR);
+  Widget* widgets[] = {
+    &descriptionValue, &temperatureValue, &pressureValue, &roomTemperatureValue,
+    &humidityValue, &humidityBar, &pressureGraph, &pressureTrend
+  };
+  const size_t count = sizeof(widgets) / sizeof(widgets[0]);
+  lgfx::LovyanGFX screen;
+  clearScreen(screen);
+  DirtyRegion region;
+
+  auto frame = [&]() {
+    region.clear();
+    for (size_t i = 0; i < count; i++) widgets[i]->addDirtyRects(region);
+    renderDirty(screen, widgets, count, region);
+    for (size_t i = 0; i < count; i++) widgets[i]->clearDirty();
+    return regionBytes(region);
+  };
+
+  descriptionValue.setText("light rain");
+  temperatureValue.setText("Temp: 12.8C");
+  pressureValue.setText("Prss: 757.1");
+  roomTemperatureValue.setText("21.5C");
+  humidityValue.setText("Hum: 82%");
+  humidityBar.setValue(82);
+  pressureGraph.push(10095);
+  pressureTrend.setTrend(TREND_STEADY);
+  CHECK(frame() > FULL_BYTES);
+
+  for (uint32_t i = 1; i < GRAPH_COLUMNS + 20; i++) {
+    pressureValue.setText("Prss: 757.1");
+    humidityBar.setValue(82);
+    pressureTrend.setTrend(TREND_STEADY);
+    pressureGraph.push(10091 + i % 8);
+
+    uint32_t bytes = frame();
+    CHECK_EQ(bytes, 2 * COLUMN_BYTES);
+  }
+
+  // Стрілка і текст додають лише свої прямокутники; колонка далеко від
+  // стрілки, тож вікна не зливаються
+  for (uint32_t i = 0; i < 80; i++) pressureGraph.push(10093);
+  frame();
+  pressureTrend.setTrend(TREND_RISING);
+  pressureValue.setText("Prss: 758.0");
+  pressureGraph.push(10094);
+  CHECK_EQ(frame(), 2 * COLUMN_BYTES + 24 * GRAPH_HEIGHT * 2 + 160 * 16 * 2);
+
+  // Нічого не змінилось - нічого не відправляється
+  CHECK_EQ(frame(), 0);
+  CHECK(sameAsFullRender(screen, widgets, count));
+}
+
+int main() {
+  testSteadyColumns();
+  testPendingColumns();
+  testRescaleOnly();
+  testNatureScreen();
+  return checkResult("widgets");
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include "timeseries.h"
+#include <string.h>
+
+#define DAY_SECONDS (24UL * 3600)
+
+const HistoryTier HISTORY_TIERS[HISTORY_TIER_COUNT] = {
+  {60,   DAY_SECONDS,       HISTORY_SLOTS(DAY_SECONDS, 60)},
+  {900,  30 * DAY_SECONDS,  HISTORY_SLOTS(30 * DAY_SECONDS, 900)},
+  {3600, 365 * DAY_SECONDS, HISTORY_SLOTS(365 * DAY_SECONDS, 3600)}
+};
+
+// Ділення з округленням до найближчого і для від'ємних сум
+static int32_t roundDiv(int64_t sum, uint16_t count) {
+  return sum >= 0 ? (int32_t)((sum + count / 2) / count) : -(int32_t)((-sum + count / 2) / count);
+}
+
+static void decodeDelta(const HistoryBlock& block, uint8_t index, int32_t& pressurePa,
+                        int16_t& temperatureDeci) {
+  const uint8_t* d = block.deltas + (index - 1) * HISTORY_SAMPLE_BYTES;
+  pressurePa += (int16_t)(d[0] | (d[1] << 8));
+  temperatureDeci += (int8_t)d[2];
+}
+
+static bool isValidBlock(const HistoryBlock& block, uint8_t tier, uint32_t seq) {
+  const HistoryBlockHeader& h = block.header;
+  return h.seq == seq && h.tier == tier && h.count > 0 && h.count <= HISTORY_BLOCK_SAMPLES;
+}
+
+HistoryLog::HistoryLog(HistoryMedium* store) : medium(store), blockWrites(0) {
+  memset(heads, 0, sizeof(heads));
+  memset(rollups, 0, sizeof(rollups));
+  for (uint8_t i = 0; i < HISTORY_TIER_COUNT; i++) {
+    tailPressure[i] = 0;
+    tailTemperature[i] = 0;
+    syncedCount[i] = 0;
+    syncedAt[i] = 0;
+  }
+}
+
+void HistoryLog::begin() {
+  HistoryBlock block;
+
+  for (uint8_t tier = 0; tier < HISTORY_TIER_COUNT; tier++) {
+    const HistoryTier& t = HISTORY_TIERS[tier];
+
+    // Номер блоку однозначно задає слот, тож найбільший номер - голова кільця
+    uint32_t best = 0;
+    for (uint16_t slot = 0; slot < t.slots; slot++) {
+      if (!medium->readBlock(tier, slot, block)) continue;
+      uint32_t seq = block.header.seq;
+      if (seq > best && seq % t.slots == slot && isValidBlock(block, tier, seq)) {
+        best = seq;
+        heads[tier] = block;
+      }
+    }
+    if (best == 0) continue;
+
+    // Хвіст для наступної різниці
+    HistoryBlockHeader& h = heads[tier].header;
+    tailPressure[tier] = h.pressurePa;
+    tailTemperature[tier] = h.temperatureDeci;
+    for (uint8_t i = 1; i < h.count; i++) {
+      decodeDelta(heads[tier], i, tailPressure[tier], tailTemperature[tier]);
+    }
+    syncedCount[tier] = h.count;
+    syncedAt[tier] = h.start + (h.count - 1) * t.interval;
+  }
+}
+
+void HistoryLog::add(const HistoryPoint& sample) {
+  feed(0, sample);
+}
+
+void HistoryLog::feed(uint8_t tier, const HistoryPoint& point) {
+  HistoryRollup& r = rollups[tier];
+  uint32_t bucket = point.time - point.time % HISTORY_TIERS[tier].interval;
+
+  if (r.count > 0 && bucket < r.bucket) return;  // годинник відступив назад
+
+  // Перша вибірка нового інтервалу закриває попередній
+  if (r.count > 0 && bucket != r.bucket) {
+    HistoryPoint mean;
+    mean.time = r.bucket;
+    mean.pressurePa = roundDiv(r.pressureSum, r.count);
+    mean.temperatureDeci = (int16_t)roundDiv(r.temperatureSum, r.count);
+    r.count = 0;
+
+    append(tier, mean);
+    if (tier + 1 < HISTORY_TIER_COUNT) {
+      feed(tier + 1, mean);
+    }
+  }
+
+  if (r.count == 0) {
+    r.bucket = bucket;
+    r.pressureSum = 0;
+    r.temperatureSum = 0;
+  }
+  r.pressureSum += point.pressurePa;
+  r.temperatureSum += point.temperatureDeci;
+  r.count++;
+}
+
+void HistoryLog::append(uint8_t tier, const HistoryPoint& point) {
+  HistoryBlock& head = heads[tier];
+  HistoryBlockHeader& h = head.header;
+  uint32_t interval = HISTORY_TIERS[tier].interval;
+
+  if (h.count > 0) {
+    uint32_t expected = h.start + h.count * interval;
+    if (point.time < expected) return;
+
+    int32_t dp = point.pressurePa - tailPressure[tier];
+    int32_t dt = point.temperatureDeci - tailTemperature[tier];
+    if (point.time == expected && h.count < HISTORY_BLOCK_SAMPLES &&
+        dp >= INT16_MIN && dp <= INT16_MAX && dt >= INT8_MIN && dt <= INT8_MAX) {
+      uint8_t* d = head.deltas + (h.count - 1) * HISTORY_SAMPLE_BYTES;
+      d[0] = (uint8_t)(dp & 0xFF);
+      d[1] = (uint8_t)((dp >> 8) & 0xFF);
+      d[2] = (uint8_t)(int8_t)dt;
+      h.count++;
+      tailPressure[tier] = point.pressurePa;
+      tailTemperature[tier] = point.temperatureDeci;
+
+      if (h.count == HISTORY_BLOCK_SAMPLES || point.time - syncedAt[tier] >= HISTORY_SYNC_SECONDS) {
+        writeHead(tier);
+      }
+      return;
+    }
+
+    // Блок закривається: повний, пропуск у часі або різниця не вміщається
+    if (syncedCount[tier] != h.count) {
+      writeHead(tier);
+    }
+  }
+
+  // Новий блок лягає на слот найстарішого - кільце не росте
+  uint32_t seq = h.seq + 1;
+  memset(&head, 0, sizeof(head));
+  h.seq = seq;
+  h.start = point.time;
+  h.pressurePa = point.pressurePa;
+  h.temperatureDeci = point.temperatureDeci;
+  h.count = 1;
+  h.tier = tier;
+  tailPressure[tier] = point.pressurePa;
+  tailTemperature[tier] = point.temperatureDeci;
+  syncedCount[tier] = 0;
+
+  if (point.time - syncedAt[tier] >= HISTORY_SYNC_SECONDS) {
+    writeHead(tier);
+  }
+}
+
+void HistoryLog::writeHead(uint8_t tier) {
+  const HistoryTier& t = HISTORY_TIERS[tier];
+  const HistoryBlockHeader& h = heads[tier].header;
+
+  if (medium->writeBlock(tier, h.seq % t.slots, heads[tier])) {
+    blockWrites++;
+  }
+  // І після невдачі: наступна спроба - з наступним відрізком, а не щохвилини
+  syncedCount[tier] = h.count;
+  syncedAt[tier] = h.start + (h.count - 1) * t.interval;
+}
+
+uint32_t HistoryLog::oldestSeq(uint8_t tier) const {
+  uint32_t head = heads[tier].header.seq;
+  uint16_t slots = HISTORY_TIERS[tier].slots;
+  return head > slots ? head - slots + 1 : 1;
+}
+
+bool HistoryLog::loadBlock(uint8_t tier, uint32_t seq, HistoryBlock& block) {
+  if (seq == heads[tier].header.seq) {
+    block = heads[tier];
+  } else if (!medium->readBlock(tier, seq % HISTORY_TIERS[tier].slots, block)) {
+    return false;
+  }
+  return isValidBlock(block, tier, seq);
+}
+
+uint32_t HistoryLog::getLatestTime() const {
+  const HistoryBlockHeader& h = heads[0].header;
+  return h.count > 0 ? h.start + (h.count - 1) * HISTORY_TIERS[0].interval : 0;
+}
+
+void HistoryLog::open(HistoryCursor& cursor, uint32_t from, uint32_t to, uint32_t resolution) {
+  uint32_t latest = getLatestTime();
+
+  uint8_t tier = 0;
+  while (tier + 1 < HISTORY_TIER_COUNT) {
+    uint32_t retention = HISTORY_TIERS[tier].retention;
+    bool covers = latest < retention || from >= latest - retention;
+    if (covers && HISTORY_TIERS[tier + 1].interval > resolution) break;
+    tier++;
+  }
+
+  uint32_t interval = HISTORY_TIERS[tier].interval;
+  cursor.tier = tier;
+  cursor.step = resolution > interval ? resolution : interval;
+  cursor.next = from;
+  cursor.to = to;
+  cursor.loaded = false;
+  cursor.done = heads[tier].header.seq == 0 || from > to;
+  if (cursor.done) return;
+
+  // Останній блок, що починається не пізніше from. Блок, який не
+  // читається, вважаємо пізнішим: зайве читання краще за пропуск даних
+  uint32_t lo = oldestSeq(tier);
+  uint32_t hi = heads[tier].header.seq;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo + 1) / 2;
+    if (loadBlock(tier, mid, cursor.block) && cursor.block.header.start <= from) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  cursor.seq = lo;
+}
+
+size_t HistoryLog::read(HistoryCursor& cursor, HistoryPoint* out, size_t max) {
+  uint32_t interval = HISTORY_TIERS[cursor.tier].interval;
+  size_t count = 0;
+
+  while (count < max && !cursor.done) {
+    if (!cursor.loaded) {
+      if (cursor.seq > heads[cursor.tier].header.seq) {
+        cursor.done = true;
+        break;
+      }
+      // Блок, який кільце вже переписало, пропускаємо
+      if (!loadBlock(cursor.tier, cursor.seq, cursor.block)) {
+        cursor.seq++;
+        continue;
+      }
+      const HistoryBlockHeader& h = cursor.block.header;
+      if (h.start + (h.count - 1) * interval < cursor.next) {
+        cursor.seq++;
+        continue;
+      }
+      cursor.index = 0;
+      cursor.loaded = true;
+    }
+
+    const HistoryBlock& block = cursor.block;
+    if (cursor.index >= block.header.count) {
+      cursor.seq++;
+      cursor.loaded = false;
+      continue;
+    }
+
+    if (cursor.index == 0) {
+      cursor.pressurePa = block.header.pressurePa;
+      cursor.temperatureDeci = block.header.temperatureDeci;
+    } else {
+      decodeDelta(block, cursor.index, cursor.pressurePa, cursor.temperatureDeci);
+    }
+    uint32_t time = block.header.start + cursor.index * interval;
+    cursor.index++;
+
+    if (time > cursor.to) {
+      cursor.done = true;
+      break;
+    }
+    // Більша за рівень роздільність - перша точка кожного кроку
+    if (time >= cursor.next) {
+      out[count].time = time;
+      out[count].pressurePa = cursor.pressurePa;
+      out[count].temperatureDeci = cursor.temperatureDeci;
+      count++;
+      cursor.next = time + cursor.step;
+    }
+  }
+
+  return count;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef TIMESERIES_H
+#define TIMESERIES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============= ЖУРНАЛ ТИСКУ І ТЕМПЕРАТУРИ =============
+// Кілька рівнів деталізації, кожен - кільце блоків фіксованого розміру
+// на носії. Блок: перша вибірка повністю, далі різниці з попередньою.
+// Час вибірки не зберігається: start + i * interval, тож пропуск у часі
+// або завелика різниця просто закривають блок.
+// Вибірки наступного рівня - середні попереднього за свій інтервал.
+// Не залежить від Arduino: носій - за HistoryMedium.
+
+#define HISTORY_TIER_COUNT   3
+#define HISTORY_BLOCK_BYTES  128
+#define HISTORY_SAMPLE_BYTES 3     // int16 різниця тиску, Па + int8 різниця температури, 0.1 C
+
+struct HistoryPoint {
+  uint32_t time;             // UTC, с
+  int32_t pressurePa;
+  int16_t temperatureDeci;   // 0.1 C
+};
+
+struct HistoryBlockHeader {
+  uint32_t seq;              // номер блоку в рівні, 0 - слот ще не писався
+  uint32_t start;            // час першої вибірки
+  int32_t pressurePa;        // перша вибірка
+  int16_t temperatureDeci;
+  uint8_t count;
+  uint8_t tier;
+};
+
+struct HistoryBlock {
+  HistoryBlockHeader header;
+  uint8_t deltas[HISTORY_BLOCK_BYTES - sizeof(HistoryBlockHeader)];
+};
+
+#define HISTORY_BLOCK_SAMPLES (1 + sizeof(((HistoryBlock*)0)->deltas) / HISTORY_SAMPLE_BYTES)
+
+// Скільки блоків тримати, щоб вмістити retention: запас на блок,
+// що заповнюється, і на блоки, закриті раніше через пропуски
+#define HISTORY_SLOTS(retention, interval) \
+  (((retention) / (interval) + HISTORY_BLOCK_SAMPLES - 1) / HISTORY_BLOCK_SAMPLES + 2)
+
+struct HistoryTier {
+  uint32_t interval;         // с між вибірками
+  uint32_t retention;        // с
+  uint16_t slots;
+};
+
+// Хвилина за добу, 15 хвилин за 30 днів, година за рік
+extern const HistoryTier HISTORY_TIERS[HISTORY_TIER_COUNT];
+
+// Незакритий блок рівня пишеться не рідше, ніж раз на стільки секунд
+// даних: обрив живлення коштує не більше цього відрізка
+#define HISTORY_SYNC_SECONDS 600
+
+class HistoryMedium {
+public:
+  virtual ~HistoryMedium() {}
+  // Слот, що ще не писався, читається нулями
+  virtual bool readBlock(uint8_t tier, uint16_t slot, HistoryBlock& block) = 0;
+  virtual bool writeBlock(uint8_t tier, uint16_t slot, const HistoryBlock& block) = 0;
+};
+
+// Середнє вибірок за поточний інтервал рівня
+struct HistoryRollup {
+  uint32_t bucket;
+  int64_t pressureSum;
+  int32_t temperatureSum;
+  uint16_t count;
+};
+
+// Стан потокового читання: блок за блоком, без копії всього діапазону
+struct HistoryCursor {
+  uint8_t tier;
+  uint32_t step;             // проріджування до запитаної роздільності
+  uint32_t next;             // найраніший час наступної точки
+  uint32_t to;
+  uint32_t seq;
+  uint8_t index;             // наступна вибірка в block
+  bool loaded;
+  bool done;
+  int32_t pressurePa;        // розкодована попередня вибірка
+  int16_t temperatureDeci;
+  HistoryBlock block;
+};
+
+class HistoryLog {
+private:
+  HistoryMedium* medium;
+  HistoryBlock heads[HISTORY_TIER_COUNT];   // блок, що заповнюється, живе в RAM
+  int32_t tailPressure[HISTORY_TIER_COUNT];
+  int16_t tailTemperature[HISTORY_TIER_COUNT];
+  uint8_t syncedCount[HISTORY_TIER_COUNT];  // скільки вибірок head уже на носії
+  uint32_t syncedAt[HISTORY_TIER_COUNT];
+  HistoryRollup rollups[HISTORY_TIER_COUNT];
+  uint32_t blockWrites;
+
+  void feed(uint8_t tier, const HistoryPoint& point);
+  void append(uint8_t tier, const HistoryPoint& point);
+  void writeHead(uint8_t tier);
+  bool loadBlock(uint8_t tier, uint32_t seq, HistoryBlock& block);
+  uint32_t oldestSeq(uint8_t tier) const;
+
+public:
+  HistoryLog(HistoryMedium* store);
+
+  // Знаходить на носії останній блок кожного рівня і продовжує його
+  void begin();
+  // Сира вибірка; до рівнів доходять середні за їхній інтервал
+  void add(const HistoryPoint& sample);
+
+  // Вибирає найгрубший рівень, що ще дає resolution і покриває from,
+  // і знаходить перший блок діапазону двійковим пошуком
+  void open(HistoryCursor& cursor, uint32_t from, uint32_t to, uint32_t resolution);
+  // До max точок; 0 - діапазон вичерпано
+  size_t read(HistoryCursor& cursor, HistoryPoint* out, size_t max);
+
+  uint32_t getLatestTime() const;
+  uint32_t getBlockWrites() const { return blockWrites; }
+};
+
+#endif // TIMESERIES_H
\ No newline at end of file
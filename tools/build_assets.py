@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Збирає web/ у web_assets.h: мінімізація, gzip і ETag.
+
+Запускати з кореня скетча після будь-якої зміни в web/:
+    python3 tools/build_assets.py
+
+Результат - масиви у флеші й таблиця WEB_ASSETS для WiFiManager.
+Стиснення детерміноване (mtime=0), тож той самий вміст дає той самий
+ETag і не змінює згенерований файл.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "web_assets.h")
+
+# Порядок: спершу ресурси, на які посилається сторінка, - їх ETag
+# підставляється в посилання index.html
+ASSETS = [
+    ("style.css", "/style.css", "text/css; charset=utf-8"),
+    ("app.js", "/app.js", "application/javascript; charset=utf-8"),
+    ("index.html", "/", "text/html; charset=utf-8"),
+]
+
+# Сторінка щоразу перевіряється через ETag (відповідь 304 - кілька байтів),
+# а CSS і JS мають версію в URL, тож кешуються назавжди
+CACHE_PAGE = "no-cache"
+CACHE_VERSIONED = "public, max-age=31536000, immutable"
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{}:;,>])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+def minify_js(text):
+    # Обережно: лише відступи, порожні рядки й коментарі на весь рядок.
+    # Переноси рядків лишаються - на них тримається вставка крапок з комою.
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    return "\n".join(line.strip() for line in text.splitlines() if line.strip())
+
+
+MINIFIERS = {".css": minify_css, ".js": minify_js, ".html": minify_html}
+
+
+def symbol(name):
+    return "WEB_ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, ",\n".join(rows))
+
+
+def main():
+    versions = {}
+    arrays = []
+    entries = []
+
+    for filename, path, content_type in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), encoding="utf-8") as f:
+            source = f.read()
+
+        text = MINIFIERS[os.path.splitext(filename)[1]](source)
+        for linked, version in versions.items():
+            text = text.replace("'%s'" % linked, "'%s?v=%s'" % (linked, version))
+
+        packed = gzip.compress(text.encode("utf-8"), compresslevel=9, mtime=0)
+        digest = hashlib.sha1(packed).hexdigest()[:16]
+        versions[path] = digest
+
+        name = symbol(filename)
+        cache = CACHE_PAGE if path == "/" else CACHE_VERSIONED
+        arrays.append(c_array(name, packed))
+        entries.append('  {"%s", "%s", "\\"%s\\"", "%s", %s, %d, %d}'
+                       % (path, content_type, digest, cache, name, len(packed),
+                          len(source.encode("utf-8"))))
+        print("%-12s %6d B -> %6d B min -> %6d B gzip" % (
+            filename, len(source.encode("utf-8")), len(text.encode("utf-8")), len(packed)))
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// Згенеровано tools/build_assets.py з каталогу web/ - не редагувати вручну\n")
+        f.write("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n#include <Arduino.h>\n\n")
+        f.write("struct WebAsset {\n"
+                "  const char* path;\n"
+                "  const char* contentType;\n"
+                "  const char* etag;\n"
+                "  const char* cacheControl;\n"
+                "  const uint8_t* data;      // gzip\n"
+                "  uint32_t length;\n"
+                "  uint32_t sourceLength;    // до мінімізації і стиснення\n"
+                "};\n\n")
+        f.write("\n".join(arrays))
+        f.write("\nstatic const WebAsset WEB_ASSETS[] = {\n%s\n};\n" % ",\n".join(entries))
+        f.write("#define WEB_ASSET_COUNT %d\n\n#endif // WEB_ASSETS_H" % len(entries))
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
@@ -1,14 +1,32 @@
 #include "weather.h"
 
-WeatherManager::WeatherManager() : lastUpdate(0) {
+WeatherManager::WeatherManager()
+  : front(0), lock(xSemaphoreCreateMutex()), jobStatus(WEATHER_JOB_IDLE), jobFinished(false), jobSucceeded(false), jobsFinished(0),
+    lastParseMicros(0), lastPayloadBytes(0), taskHandle(NULL), scheduler(NULL), lastUpdate(0) {
+  jobApiKey[0] = '\0';
   // Встановлюємо lastUpdate так, щоб перше оновлення відбулося відразу
   lastUpdate = millis() - WEATHER_UPDATE_INTERVAL;
 }
 
+void WeatherManager::begin(Scheduler* sched) {
+  if (taskHandle != NULL) return;
+
+  scheduler = sched;
+  xTaskCreate(taskEntry, "weather", WEATHER_TASK_STACK, this, WEATHER_TASK_PRIORITY, &taskHandle);
+}
+
 void WeatherManager::setApiKey(const String& key) {
   apiKey = key;
   // При зміні API ключа скидаємо lastUpdate для негайного оновлення
   lastUpdate = millis() - WEATHER_UPDATE_INTERVAL;
+  if (scheduler != NULL) {
+    scheduler->post(SCHED_EVENT_WEATHER);
+  }
+}
+
+bool WeatherManager::isBusy() const {
+  uint8_t status = jobStatus.load();
+  return status == WEATHER_JOB_QUEUED || status == WEATHER_JOB_RUNNING;
 }
 
 bool WeatherManager::shouldUpdate() const {
@@ -16,12 +34,123 @@ bool WeatherManager::shouldUpdate() const {
   if (apiKey.length() == 0) {
     return false;
   }
-  
-  return (millis() - lastUpdate >= WEATHER_UPDATE_INTERVAL);
+
+  return !isBusy() && (millis() - lastUpdate >= WEATHER_UPDATE_INTERVAL);
 }
 
-bool WeatherManager::fetchWeatherData() {
-  if (apiKey.length() == 0) {
+bool WeatherManager::requestUpdate() {
+  if (taskHandle == NULL || apiKey.length() == 0) {
+    return false;
+  }
+  if (isBusy()) {
+    return true;  // Запит уже в роботі
+  }
+
+  // Задача отримує власну копію ключа, String не ділиться між задачами
+  strlcpy(jobApiKey, apiKey.c_str(), sizeof(jobApiKey));
+  lastUpdate = millis();
+  jobStatus.store(WEATHER_JOB_QUEUED);
+  xTaskNotifyGive(taskHandle);
+  return true;
+}
+
+uint32_t WeatherManager::msUntilDue() const {
+  if (jobFinished.load()) {
+    return 0;  // Є що публікувати
+  }
+  if (apiKey.length() == 0 || isBusy()) {
+    return SCHEDULER_IDLE;
+  }
+
+  unsigned long elapsed = millis() - lastUpdate;
+  return elapsed >= WEATHER_UPDATE_INTERVAL ? 0 : WEATHER_UPDATE_INTERVAL - elapsed;
+}
+
+void WeatherManager::update() {
+  if (jobFinished.load()) {
+    if (jobSucceeded.load()) {
+      // Публікація: задній буфер стає переднім. Наступний запит
+      // почнеться лише після неї, тож колишній передній уже ніхто не читає
+      xSemaphoreTake(lock, portMAX_DELAY);
+      front.store(front.load() ^ 1);
+      xSemaphoreGive(lock);
+      lastUpdate = millis();
+      jobStatus.store(WEATHER_JOB_DONE);
+    } else {
+      // Якщо запит не вдався, повторюємо раніше
+      lastUpdate = millis() - WEATHER_UPDATE_INTERVAL + WEATHER_RETRY_INTERVAL;
+      jobStatus.store(WEATHER_JOB_FAILED);
+    }
+    jobFinished.store(false);
+    jobsFinished.fetch_add(1);
+  }
+
+  if (shouldUpdate()) {
+    requestUpdate();
+  }
+}
+
+bool WeatherManager::getSnapshot(WeatherData& out) const {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  out = buffers[front.load()];
+  xSemaphoreGive(lock);
+  return out.hasData;
+}
+
+const char* WeatherManager::getJobStatusName() const {
+  switch (getJobStatus()) {
+    case WEATHER_JOB_QUEUED:  return "queued";
+    case WEATHER_JOB_RUNNING: return "running";
+    case WEATHER_JOB_DONE:    return "done";
+    case WEATHER_JOB_FAILED:  return "failed";
+    default:                  return "idle";
+  }
+}
+
+void WeatherManager::taskEntry(void* arg) {
+  static_cast<WeatherManager*>(arg)->taskLoop();
+}
+
+void WeatherManager::taskLoop() {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    jobStatus.store(WEATHER_JOB_RUNNING);
+    // Пишемо лише в задній буфер; передній читає loop()
+    uint8_t back = front.load() ^ 1;
+    jobSucceeded.store(fetchWeatherData(buffers[back]));
+    jobFinished.store(true);
+    if (scheduler != NULL) {
+      scheduler->post(SCHED_EVENT_WEATHER);
+    }
+  }
+}
+
+bool parseWeather(Stream& input, WeatherData& target) {
+  // Фільтр залишає лише потрібні поля, решта відповіді
+  // пропускається під час розбору і не займає пам'яті
+  StaticJsonDocument<WEATHER_FILTER_BYTES> filter;
+  filter["weather"][0]["description"] = true;
+  filter["main"]["temp"] = true;
+  filter["main"]["humidity"] = true;
+  filter["main"]["pressure"] = true;
+
+  StaticJsonDocument<WEATHER_DOC_BYTES> doc;
+  DeserializationError error = deserializeJson(doc, input, DeserializationOption::Filter(filter));
+  if (error) {
+    return false;
+  }
+
+  strlcpy(target.description, doc["weather"][0]["description"] | "", sizeof(target.description));
+  target.temperature = doc["main"]["temp"];
+  target.humidity = doc["main"]["humidity"];
+  target.pressure = doc["main"]["pressure"];
+  target.hasData = true;
+  return true;
+}
+
+bool WeatherManager::fetchWeatherData(WeatherData& target) {
+  if (jobApiKey[0] == '\0') {
     return false; // Не робимо запит без ключа
   }
 
@@ -29,10 +158,12 @@ bool WeatherManager::fetchWeatherData() {
   String url = "http://api.openweathermap.org/data/2.5/weather?q=";
   url += WEATHER_CITY;
   url += "&appid=";
-  url += apiKey;
+  url += jobApiKey;
   url += "&units=metric";
   url += "&lang=en";
 
+  // HTTP/1.0 вимикає chunked-кодування, тож JSON читається прямо з сокета
+  http.useHTTP10(true);
   http.begin(url);
   http.setTimeout(10000); // Таймаут 10 секунд
   int httpCode = http.GET();
@@ -41,32 +172,18 @@ bool WeatherManager::fetchWeatherData() {
 
   if (httpCode > 0) {
     if (httpCode == HTTP_CODE_OK) {
-      String payload = http.getString();
-
-      StaticJsonDocument<1024> doc;
-      DeserializationError error = deserializeJson(doc, payload);
-
-      if (!error) {
-        // Оновлюємо дані про погоду
-        data.description = doc["weather"][0]["description"].as<String>();
-        data.temperature = doc["main"]["temp"];
-        data.humidity = doc["main"]["humidity"];
-        data.pressure = doc["main"]["pressure"];
-        data.hasData = true;
-        data.lastUpdate = millis();
-
-        lastUpdate = millis();
-        success = true;
+      uint32_t parseStart = micros();
+      success = parseWeather(http.getStream(), target);
+      lastParseMicros.store(micros() - parseStart);
+      lastPayloadBytes.store(http.getSize());
+
+      if (success) {
+        target.lastUpdate = millis();
       }
     }
   }
 
   http.end();
 
-  // Якщо запит не вдався, не оновлюємо lastUpdate
-  if (!success) {
-    lastUpdate = millis() - WEATHER_UPDATE_INTERVAL + 30000;
-  }
-
   return success;
 }
\ No newline at end of file
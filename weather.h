@@ -4,31 +4,73 @@
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <atomic>
 #include "config.h"
+#include "scheduler.h"
+
+enum WeatherJobStatus {
+  WEATHER_JOB_IDLE = 0,
+  WEATHER_JOB_QUEUED,
+  WEATHER_JOB_RUNNING,
+  WEATHER_JOB_DONE,
+  WEATHER_JOB_FAILED
+};
+
+// Запит виконує фонова задача у задній буфер, задача UI публікує
+// результат заміною індексу переднього буфера. Читачів дві задачі (UI
+// і "net"), тож заміна і копіювання переднього буфера - під м'ютексом,
+// а назовні йде лише копія: посилання пережило б заміну, і задача
+// запиту писала б у буфер, який ще читають.
+// Розбір відповіді OpenWeatherMap прямо з потоку: фільтр лишає опис,
+// температуру, вологість і тиск, купа не використовується.
+// false - помилка JSON або поля не вмістились у документ.
+bool parseWeather(Stream& input, WeatherData& target);
 
 class WeatherManager {
 private:
   String apiKey;
-  WeatherData data;
+  WeatherData buffers[2];
+  std::atomic<uint8_t> front;
+  SemaphoreHandle_t lock;
+  std::atomic<uint8_t> jobStatus;
+  std::atomic<bool> jobFinished;
+  std::atomic<bool> jobSucceeded;
+  std::atomic<uint32_t> jobsFinished;  // опубліковані результати, і невдалі теж
+  std::atomic<uint32_t> lastParseMicros;
+  std::atomic<int32_t> lastPayloadBytes;
+  char jobApiKey[WEATHER_KEY_MAX];
+  TaskHandle_t taskHandle;
+  Scheduler* scheduler;
   unsigned long lastUpdate;
 
+  static void taskEntry(void* arg);
+  void taskLoop();
+  bool fetchWeatherData(WeatherData& target);
+  bool isBusy() const;
+
 public:
   WeatherManager();
   
+  // sched будиться подією SCHED_EVENT_WEATHER, коли результат готовий
+  void begin(Scheduler* sched);
   void setApiKey(const String& key);
   String getApiKey() const { return apiKey; }
   bool hasApiKey() const { return apiKey.length() > 0; }
   
-  bool fetchWeatherData();
+  bool requestUpdate();
+  void update();
   bool shouldUpdate() const;
+  // Через скільки мс update() знову має щось робити;
+  // SCHEDULER_IDLE - до події від фонової задачі чи нового ключа
+  uint32_t msUntilDue() const;
+  WeatherJobStatus getJobStatus() const { return (WeatherJobStatus)jobStatus.load(); }
+  const char* getJobStatusName() const;
+  uint32_t getJobsFinished() const { return jobsFinished.load(); }
+  uint32_t getLastParseMicros() const { return lastParseMicros.load(); }
+  int32_t getLastPayloadBytes() const { return lastPayloadBytes.load(); }
   
-  const WeatherData& getData() const { return data; }
-  bool hasData() const { return data.hasData; }
-  
-  String getDescription() const { return data.description; }
-  float getTemperature() const { return data.temperature; }
-  int getHumidity() const { return data.humidity; }
-  int getPressure() const { return data.pressure; }
+  // Копія переднього буфера; false - даних ще немає
+  bool getSnapshot(WeatherData& out) const;
 };
 
 #endif // WEATHER_H
\ No newline at end of file
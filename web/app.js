@@ -0,0 +1,284 @@
+const api = (url, opts) => fetch(url, opts).then(r => opts?.json !== false ? r.json() : r.text());
+
+function connectWiFi() {
+  const ssid = document.getElementById('ssid').value;
+  const password = document.getElementById('password').value;
+  const params = new URLSearchParams({ssid, password});
+
+  api('/connect', {
+    method: 'POST',
+    headers: {'Content-Type': 'application/x-www-form-urlencoded'},
+    body: params,
+    json: false
+  })
+  .then(data => {
+    document.getElementById('wifiStatus').innerHTML = `<span class="info">✓ ${data}</span>`;
+  })
+  .catch(e => {
+    document.getElementById('wifiStatus').innerHTML = `<span class="error">✗ ${e}</span>`;
+  });
+}
+
+function setApiKey() {
+  const apiKey = document.getElementById('apiKey').value;
+
+  if (!apiKey) {
+    document.getElementById('apiKeyStatus').innerHTML = 
+      '<span class="error">✗ Please enter API key</span>';
+    return;
+  }
+
+  api('/weather/apikey', {
+    method: 'POST',
+    headers: {'Content-Type': 'application/json'},
+    body: JSON.stringify({apiKey})
+  })
+  .then(data => {
+    document.getElementById('apiKeyStatus').innerHTML = 
+      `<span class="info">✓ API Key saved: ${data.apiKey}</span>`;
+    document.getElementById('apiKey').value = '';
+  })
+  .catch(e => {
+    document.getElementById('apiKeyStatus').innerHTML = 
+      `<span class="error">✗ Failed: ${e}</span>`;
+  });
+}
+
+function getStatus() {
+  api('/status')
+  .then(data => {
+    const html = [
+      `<span class="info">IP: ${data.ip}</span>`,
+      `Screen: ${data.screen}`,
+      `Uptime: ${(data.uptime / 1000).toFixed(0)}s`,
+      `WiFi: ${data.wifi.ssid} ${data.wifi.state}, boot to connected ${data.wifi.bootConnectMs} ms${data.wifi.fastPath ? ' (fast path)' : ''}, RSSI ${data.wifi.rssi} dBm, ${data.wifi.disconnects} drops, reconnect ${data.wifi.reconnectMs} ms (max ${data.wifi.maxReconnectMs} ms)`,
+      `Alarm: next ${data.alarm.enabled ? new Date(data.alarm.next * 1000).toLocaleString() : 'none'}`,
+      `Audio underruns: ${data.alarm.underruns}`,
+      `Display: ${data.display.frameBytes} B last frame, render ${data.display.renderUs} us, transfer ${data.display.transferUs} us`,
+      `Frames: ${data.display.framesSubmitted} submitted / ${data.display.framesCompleted} complete`,
+      `Transitions: ${data.display.transitions}, dropped frames ${data.display.droppedFrames}`,
+      `Button to screen: ${data.display.inputLatencyUs} us (max ${data.display.maxInputLatencyUs} us)`,
+      `Frame time (<=16/33/50/100/>100 ms): ${data.display.frameHistogram.join(' / ')}`,
+      `Web assets: ${data.web.assetRequests} requests, ${data.web.notModified} not modified, ${data.web.bytesSent} B sent (${data.web.bytesUncompressed} B uncompressed), handler ${data.web.handlerUs} us (max ${data.web.maxHandlerUs} us)`,
+      `HTTP: ${data.web.requests} requests, ${data.web.connections} connections (peak ${data.web.peakConnections}), ${data.web.reused} keep-alive, ${data.web.rejected} rejected, ${data.web.timeouts} timeouts`,
+      `Response time (<=5/20/50/200/>200 ms): ${data.web.responseHistogram.join(' / ')}, max ${data.web.maxResponseUs} us`,
+      `NVS: ${data.storage.nvsWrites} writes, ${data.storage.flushes} settings flushes, ${data.storage.skipped} unchanged skipped${data.storage.dirty ? ', pending' : ''}`,
+      `History: ${data.storage.historyBlockWrites} block writes, latest ${data.storage.historyLatest ? new Date(data.storage.historyLatest * 1000).toLocaleString() : 'none'}`,
+      `Idle: ${(data.scheduler.idlePermille / 10).toFixed(1)}%`,
+      ...data.scheduler.jobs.map(j => `Job ${j.name}: ${j.runs} runs, max latency ${j.maxLatencyUs} us, max run ${j.maxRunUs} us`),
+      `Framebuffer: ${data.display.framebufferHeap} B heap (was ${data.display.legacySpriteBytes} B), free ${data.display.freeHeap} B`
+    ].join('<br>');
+    document.getElementById('systemStatus').innerHTML = html;
+  });
+
+  api('/weather/apikey')
+  .then(data => {
+    if (data.hasKey) {
+      document.getElementById('apiKeyStatus').innerHTML = 
+        `<span class="info">✓ API Key configured: ${data.apiKey}</span>`;
+    }
+  });
+}
+
+// Біти днів - як tm_wday на пристрої: 0 - неділя
+const DAY_NAMES = ['Sun', 'Mon', 'Tue', 'Wed', 'Thu', 'Fri', 'Sat'];
+const pad = n => String(n).padStart(2, '0');
+
+function describeDays(days) {
+  if (days === 0) return 'once';
+  if (days === 127) return 'every day';
+  if (days === 62) return 'weekdays';
+  if (days === 65) return 'weekends';
+  return DAY_NAMES.filter((_, i) => days & (1 << i)).join(' ');
+}
+
+function alarmRequest(body) {
+  return api('/alarm', {
+    method: 'POST',
+    headers: {'Content-Type': 'application/json'},
+    body: JSON.stringify(body)
+  })
+  .then(data => {
+    if (data.status === 'error') throw data.message;
+  })
+  .catch(e => {
+    document.getElementById('alarmStatus').innerHTML = `<span class="error">✗ ${e}</span>`;
+  })
+  // Список змінює задача UI пристрою - перечитуємо трохи згодом
+  .then(() => setTimeout(loadAlarms, 300));
+}
+
+function loadAlarms() {
+  api('/alarm')
+  .then(data => {
+    const rows = data.alarms.map(a => {
+      const when = a.next ? new Date(a.next * 1000).toLocaleString() : '-';
+      return `${pad(a.hour)}:${pad(a.minute)} ${describeDays(a.days)} ` +
+        `${a.enabled ? 'ON' : 'OFF'}${a.skip ? ' (skip next)' : ''}, next ${when} ` +
+        `<button onclick='alarmRequest({id: ${a.id}, toggle: true})'>On/Off</button>` +
+        (a.days ? `<button onclick='alarmRequest({id: ${a.id}, skip: ${!a.skip}})'>${a.skip ? 'Unskip' : 'Skip next'}</button>` : '') +
+        `<button onclick='deleteAlarm(${a.id})'>Delete</button>`;
+    });
+    if (data.snoozedUntil) {
+      rows.push(`<span class="warning">Snoozed until ${new Date(data.snoozedUntil * 1000).toLocaleTimeString()}</span>`);
+    }
+    document.getElementById('alarmList').innerHTML = rows.length ? rows.join('<br>') : 'No alarms';
+  });
+}
+
+function addAlarm() {
+  const hour = parseInt(document.getElementById('alarmHour').value);
+  const minute = parseInt(document.getElementById('alarmMinute').value);
+  const days = parseInt(document.getElementById('alarmDays').value);
+
+  document.getElementById('alarmStatus').innerHTML = 
+    `<span class="info">✓ Alarm ${pad(hour)}:${pad(minute)} ${describeDays(days)}</span>`;
+  alarmRequest({hour, minute, days});
+}
+
+function deleteAlarm(id) {
+  api(`/alarm?id=${id}`, {method: 'DELETE'})
+  .then(() => setTimeout(loadAlarms, 300));
+}
+
+function snoozeAlarm() {
+  alarmRequest({snooze: true});
+}
+
+function stopAlarm() {
+  alarmRequest({stop: true});
+}
+
+// Мелодія декодується і передискретизується в браузері
+// до 16 кГц моно PCM16, пристрій лише стискає її в ADPCM
+const RINGTONE_RATE = 16000;
+const RINGTONE_MAX_SEC = 30;
+
+async function uploadRingtone() {
+  const file = document.getElementById('ringtoneFile').files[0];
+  const status = document.getElementById('ringtoneStatus');
+
+  if (!file) {
+    status.innerHTML = '<span class="error">✗ Please choose a file</span>';
+    return;
+  }
+
+  try {
+    status.innerHTML = '<span class="warning">Converting...</span>';
+    const decoded = await new AudioContext().decodeAudioData(await file.arrayBuffer());
+    const seconds = Math.min(decoded.duration, RINGTONE_MAX_SEC);
+    const offline = new OfflineAudioContext(1, Math.ceil(seconds * RINGTONE_RATE), RINGTONE_RATE);
+    const source = offline.createBufferSource();
+    source.buffer = decoded;
+    source.connect(offline.destination);
+    source.start();
+
+    const mono = (await offline.startRendering()).getChannelData(0);
+    const pcm = new Int16Array(mono.length);
+    for (let i = 0; i < mono.length; i++) {
+      pcm[i] = Math.max(-1, Math.min(1, mono[i])) * 32767;
+    }
+
+    // Сирий PCM без multipart - пристрій стискає тіло частинами, як воно приходить
+    status.innerHTML = '<span class="warning">Uploading...</span>';
+    const data = await api('/ringtone', {
+      method: 'POST',
+      headers: {'Content-Type': 'application/octet-stream'},
+      body: pcm.buffer
+    });
+    status.innerHTML = data.status === 'success' ?
+      `<span class="info">✓ Saved ${(data.durationMs / 1000).toFixed(1)}s</span>` :
+      '<span class="error">✗ Upload failed</span>';
+  } catch (e) {
+    status.innerHTML = `<span class="error">✗ ${e}</span>`;
+  }
+}
+
+function playRingtone() {
+  api('/ringtone/play', {method: 'POST'});
+}
+
+function deleteRingtone() {
+  api('/ringtone', {method: 'DELETE'})
+  .then(() => {
+    document.getElementById('ringtoneStatus').innerHTML = 
+      '<span class="info">✓ Default beep restored</span>';
+  });
+}
+
+function showWeather(data) {
+  const html = [
+    '<span class="info">✓ Updated!</span>',
+    `Description: ${data.description}`,
+    `Temperature: ${data.temperature}°C`,
+    `Humidity: ${data.humidity}%`,
+    `Pressure: ${data.pressure} hPa`
+  ].join('<br>');
+  document.getElementById('weatherStatus').innerHTML = html;
+}
+
+// Запит виконується на пристрої у фоні, тож опитуємо /weather
+function pollWeather(attempts) {
+  api('/weather')
+  .then(data => {
+    if (data.status === 'done') {
+      showWeather(data);
+    } else if (data.status === 'failed' || attempts <= 0) {
+      document.getElementById('weatherStatus').innerHTML = 
+        '<span class="error">✗ Update failed</span>';
+    } else {
+      setTimeout(() => pollWeather(attempts - 1), 1000);
+    }
+  });
+}
+
+// Пристрій відповідає, коли запит погоди завершився; опитування
+// лишається на випадок, якщо відповідь прийшла раніше
+function updateWeather() {
+  document.getElementById('weatherStatus').innerHTML = 
+    '<span class="warning">Updating...</span>';
+  api('/weather/update')
+  .then(data => {
+    if (data.status === 'done') {
+      showWeather(data);
+    } else {
+      pollWeather(15);
+    }
+  })
+  .catch(e => {
+    document.getElementById('weatherStatus').innerHTML = 
+      `<span class="error">✗ Update failed: ${e}</span>`;
+  });
+}
+
+// Живі зміни приходять потоком подій; пристрій надсилає лише змінені
+// групи, а EventSource сам перепідключається
+const live = {};
+
+function renderLive() {
+  const lines = [];
+  if (live.screen !== undefined) lines.push(`Screen: ${live.screen}`);
+  if (live.wifi) lines.push(`WiFi: ${live.wifi.state}, RSSI ${live.wifi.rssi} dBm`);
+  if (live.sensor) lines.push(`Sensor: ${live.sensor.pressure ?? '--'} hPa, ${live.sensor.temperature ?? '--'}°C`);
+  if (live.alarm) {
+    const minute = String(live.alarm.minute).padStart(2, '0');
+    lines.push(`Alarm: ${live.alarm.hour}:${minute} ${live.alarm.enabled ? 'ON' : 'OFF'}${live.alarm.ringing ? ' - RINGING' : ''}`);
+  }
+  document.getElementById('liveStatus').innerHTML = lines.join('<br>');
+}
+
+function startEvents() {
+  const events = new EventSource('/events');
+  events.onmessage = e => {
+    const data = JSON.parse(e.data);
+    Object.assign(live, data);
+    if (data.weather && data.weather.hasData) {
+      showWeather(data.weather);
+    }
+    renderLive();
+  };
+}
+
+getStatus();
+loadAlarms();
+startEvents();
@@ -0,0 +1,306 @@
+// Згенеровано tools/build_assets.py з каталогу web/ - не редагувати вручну
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const char* etag;
+  const char* cacheControl;
+  const uint8_t* data;      // gzip
+  uint32_t length;
+  uint32_t sourceLength;    // до мінімізації і стиснення
+};
+
+static const uint8_t WEB_ASSET_STYLE_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x52, 0xdb, 0x6e, 0x9c, 0x30,
+  0x10, 0xfd, 0x15, 0xa4, 0xa8, 0x4a, 0x52, 0x01, 0xb2, 0xc9, 0x52, 0x45, 0xf0, 0xd8, 0xc7, 0x4a,
+  0xfd, 0x87, 0xc1, 0x17, 0xb0, 0x02, 0x1e, 0x64, 0x4c, 0x60, 0x8b, 0xfc, 0xef, 0x35, 0x06, 0xba,
+  0x8b, 0x94, 0xa8, 0xe1, 0x09, 0xc6, 0xe6, 0x5c, 0xe7, 0xfb, 0xd2, 0x81, 0xa9, 0x95, 0x2e, 0x48,
+  0xd9, 0x03, 0xe7, 0x4a, 0xd7, 0xfe, 0xad, 0xc2, 0x39, 0x19, 0xd4, 0x9f, 0xf5, 0xa3, 0x42, 0xc3,
+  0x85, 0x49, 0xfc, 0xc4, 0x55, 0xc8, 0xaf, 0x8b, 0x44, 0x6d, 0x13, 0x09, 0x9d, 0x6a, 0xaf, 0xc5,
+  0xe3, 0x4f, 0x1c, 0x8d, 0x12, 0x26, 0xfa, 0x2d, 0xa6, 0xc7, 0xb8, 0x43, 0x8d, 0x43, 0x0f, 0x4c,
+  0x94, 0x15, 0xb0, 0xb7, 0xda, 0xe0, 0xa8, 0x79, 0xf1, 0x40, 0x80, 0x08, 0x7a, 0x29, 0x19, 0xb6,
+  0x68, 0xfc, 0x17, 0x91, 0xf2, 0x42, 0xcb, 0x4e, 0xe9, 0xa4, 0x11, 0xaa, 0x6e, 0x6c, 0x41, 0x09,
+  0x79, 0x6f, 0xfe, 0x51, 0x67, 0xa4, 0x9f, 0x5d, 0xca, 0x3c, 0x07, 0x28, 0x2d, 0x8c, 0xd7, 0x36,
+  0x27, 0x93, 0xe2, 0xb6, 0x29, 0x5e, 0x89, 0x3f, 0x2a, 0x0f, 0xad, 0x11, 0x8c, 0x16, 0x4f, 0x3c,
+  0x14, 0xa8, 0xcc, 0x3c, 0x75, 0x90, 0x5b, 0x64, 0xfd, 0x1c, 0x0d, 0xd8, 0x2a, 0x1e, 0x1d, 0x94,
+  0xbb, 0x0f, 0x03, 0x5c, 0x8d, 0x43, 0x91, 0x7b, 0xac, 0x7b, 0xce, 0xcd, 0x71, 0x03, 0x1c, 0x27,
+  0x0f, 0x4e, 0xa2, 0x75, 0x16, 0x99, 0xba, 0x82, 0x27, 0x12, 0x67, 0x79, 0x1e, 0xff, 0xc8, 0xe3,
+  0xf4, 0xe5, 0xd9, 0x35, 0x74, 0xb1, 0x62, 0xb6, 0x09, 0xb4, 0xaa, 0xd6, 0x05, 0x13, 0xda, 0x0a,
+  0xb3, 0x6b, 0xf2, 0x09, 0x59, 0x8b, 0xdd, 0x86, 0x16, 0x2e, 0xdd, 0xc1, 0xd1, 0x15, 0x6e, 0x57,
+  0xe2, 0xd2, 0x41, 0x30, 0xab, 0x50, 0x1f, 0xc1, 0x07, 0xae, 0x5b, 0xfa, 0x34, 0x0f, 0x72, 0x82,
+  0x0d, 0xfa, 0x1f, 0x1b, 0x2f, 0x6b, 0x5a, 0x3b, 0x5c, 0xd4, 0x64, 0xcb, 0x59, 0xca, 0xca, 0x7a,
+  0x0b, 0x9e, 0x31, 0x29, 0x5d, 0x35, 0xfa, 0x13, 0xbd, 0x9c, 0x0a, 0xda, 0x80, 0x8f, 0x7b, 0x5b,
+  0x5d, 0x3b, 0xbf, 0x46, 0x2d, 0x6e, 0xc2, 0x56, 0x9d, 0xd9, 0x5d, 0x0b, 0xab, 0x50, 0x36, 0x9a,
+  0xc1, 0xff, 0xd7, 0xa3, 0x0a, 0x59, 0x7c, 0x65, 0x3b, 0xc2, 0x9d, 0x69, 0x6b, 0xbf, 0xc2, 0x96,
+  0x7f, 0xe0, 0x69, 0x93, 0x59, 0x34, 0xf8, 0xee, 0x77, 0xe0, 0x2c, 0x36, 0xd8, 0x50, 0xba, 0x1f,
+  0x6d, 0x3c, 0x88, 0xd6, 0x5b, 0x5f, 0x3e, 0xd8, 0xb6, 0x4f, 0xe3, 0x3b, 0xaf, 0xe1, 0xe1, 0xec,
+  0xf5, 0xec, 0xe9, 0x0b, 0x26, 0xdc, 0x03, 0xf4, 0xea, 0x97, 0xb8, 0x2e, 0xdb, 0x72, 0x32, 0x68,
+  0xd9, 0x93, 0xdf, 0xe4, 0x6f, 0x51, 0x12, 0xba, 0x7e, 0xf6, 0xad, 0x58, 0xb0, 0xe3, 0xb0, 0xdc,
+  0x87, 0x77, 0x70, 0xd0, 0xad, 0xf0, 0x4f, 0x75, 0x27, 0xad, 0x90, 0x76, 0xcd, 0xe1, 0x2c, 0xde,
+  0xa5, 0x4a, 0x4b, 0x5c, 0xce, 0x85, 0xa6, 0x13, 0x18, 0xed, 0x09, 0x8e, 0xb1, 0x94, 0x00, 0x84,
+  0xb8, 0x54, 0x18, 0x83, 0xe6, 0x36, 0xbc, 0xf8, 0xc7, 0xfd, 0x05, 0x98, 0x68, 0x69, 0xc5, 0xeb,
+  0x03, 0x00, 0x00
+};
+
+static const uint8_t WEB_ASSET_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x1a, 0xdb, 0x72, 0xdc, 0xba,
+  0xed, 0x7d, 0xbf, 0x82, 0x39, 0x93, 0x1e, 0x49, 0x27, 0x6b, 0xad, 0xed, 0x4c, 0x72, 0x66, 0x7c,
+  0xcb, 0xf8, 0xda, 0xf8, 0xd4, 0xb7, 0xf1, 0xda, 0x4d, 0x3b, 0x99, 0x4c, 0xcc, 0x95, 0xb8, 0x5e,
+  0xc5, 0x5a, 0x51, 0x15, 0xa9, 0x6c, 0xb6, 0x3e, 0xfa, 0x8a, 0x3e, 0xf4, 0xa5, 0x1f, 0xd1, 0x6f,
+  0xe8, 0xa7, 0xf4, 0x4b, 0x0a, 0x80, 0xd4, 0x6d, 0x6f, 0x71, 0x4e, 0x4e, 0x67, 0x92, 0xac, 0x48,
+  0x80, 0x20, 0x00, 0x02, 0x20, 0x00, 0x26, 0x90, 0x89, 0xd2, 0x8c, 0xa7, 0x11, 0xdb, 0x65, 0x6e,
+  0x9e, 0xc5, 0x5d, 0x26, 0x53, 0xad, 0x3c, 0xb6, 0xbb, 0xc7, 0x86, 0x42, 0x07, 0xa3, 0xc6, 0x9c,
+  0xaf, 0x47, 0x22, 0x71, 0x33, 0x04, 0xe1, 0xf8, 0x8d, 0xff, 0x49, 0xc9, 0x84, 0x3d, 0xdb, 0xdd,
+  0x65, 0x43, 0x1e, 0x2b, 0xc1, 0xde, 0xb0, 0x8c, 0xa6, 0x5c, 0x8f, 0x6d, 0xc1, 0xa7, 0x16, 0x5f,
+  0xb4, 0xeb, 0x79, 0xdb, 0x9d, 0x61, 0x9e, 0x04, 0x3a, 0x02, 0xd4, 0x40, 0x26, 0x89, 0x08, 0xf4,
+  0xbb, 0xe8, 0x24, 0x02, 0x9c, 0xc7, 0x4e, 0x40, 0x7b, 0x2b, 0x15, 0x85, 0xb0, 0x79, 0x28, 0x83,
+  0x7c, 0x2c, 0x12, 0xed, 0xdf, 0x0b, 0x7d, 0x1c, 0x0b, 0xfc, 0x3c, 0x98, 0x9e, 0x86, 0xae, 0x83,
+  0x70, 0xc7, 0xf3, 0x3f, 0xf3, 0x38, 0x17, 0xdb, 0x76, 0x4d, 0xca, 0x95, 0x9a, 0xc8, 0x6c, 0xe5,
+  0xba, 0x12, 0x67, 0x7e, 0x6d, 0xc6, 0xc7, 0x0a, 0x56, 0x26, 0x62, 0xc2, 0x6e, 0xaf, 0xcf, 0xfa,
+  0x82, 0x67, 0xc1, 0xe8, 0x8a, 0x66, 0xdd, 0x47, 0xdc, 0xad, 0x5b, 0xd1, 0x2f, 0x80, 0x7d, 0xd0,
+  0x8d, 0xeb, 0xf4, 0x2c, 0xef, 0x4e, 0x17, 0xf8, 0x1e, 0x0b, 0x3d, 0x92, 0xe1, 0x16, 0x73, 0xae,
+  0x2e, 0xfb, 0x37, 0x4e, 0xb7, 0x33, 0x12, 0x3c, 0x14, 0x99, 0xda, 0x62, 0x8f, 0xce, 0xa1, 0x4c,
+  0x34, 0x70, 0xb0, 0x76, 0x33, 0x4d, 0x85, 0x03, 0x18, 0x3c, 0x4d, 0xe3, 0x28, 0xe0, 0x28, 0x7e,
+  0xef, 0xcb, 0xda, 0x64, 0x32, 0x59, 0x1b, 0xca, 0x6c, 0xbc, 0x06, 0x4a, 0x15, 0x49, 0x20, 0x43,
+  0x11, 0x3a, 0x45, 0xb7, 0x33, 0x90, 0xe1, 0x74, 0xcb, 0xf2, 0xd5, 0xed, 0xa0, 0x0a, 0xb7, 0x8c,
+  0x4a, 0x3b, 0x85, 0xd7, 0x31, 0x5a, 0x0f, 0xb9, 0xe6, 0xa8, 0xf8, 0xc7, 0xce, 0x52, 0x79, 0x27,
+  0xd1, 0x30, 0xea, 0x6b, 0xae, 0x73, 0x05, 0x12, 0x47, 0xc0, 0x6d, 0xf6, 0xf6, 0xe6, 0xfc, 0x0c,
+  0xe4, 0xbc, 0xdb, 0x51, 0x29, 0x07, 0xed, 0xc7, 0x20, 0xd4, 0xee, 0x0f, 0x51, 0x32, 0x94, 0x3f,
+  0xec, 0xfd, 0xf7, 0x5f, 0xff, 0x60, 0xcf, 0x1f, 0x91, 0x6a, 0xb1, 0xd3, 0x43, 0xf0, 0xde, 0xdd,
+  0x36, 0xed, 0x06, 0xbc, 0xc2, 0xa1, 0x8b, 0xdf, 0x67, 0x2f, 0x91, 0x65, 0x32, 0xc3, 0xcd, 0xfe,
+  0x09, 0x9b, 0x89, 0xd6, 0x4e, 0xf0, 0xb7, 0x36, 0x0c, 0x25, 0xf4, 0x7e, 0x1a, 0xfd, 0x49, 0x4c,
+  0x1b, 0x66, 0xc1, 0x69, 0x62, 0xd5, 0x01, 0x1b, 0x8c, 0xfa, 0x78, 0xa3, 0x21, 0x73, 0x9f, 0x99,
+  0x49, 0x6f, 0x15, 0xf3, 0x06, 0x65, 0x11, 0xfb, 0x1d, 0x67, 0x19, 0xfb, 0x57, 0xb1, 0xe0, 0x60,
+  0xe2, 0x40, 0x43, 0x64, 0x6c, 0xff, 0xea, 0x94, 0x3d, 0x88, 0xa9, 0x15, 0xc7, 0xd9, 0xee, 0x64,
+  0x42, 0xe7, 0x59, 0x82, 0x22, 0x19, 0x63, 0x99, 0x08, 0x0e, 0xa7, 0x96, 0xf5, 0x60, 0x04, 0x78,
+  0xdf, 0x63, 0x33, 0x68, 0x0c, 0xb5, 0x89, 0xfc, 0xd2, 0xbf, 0xbc, 0xf0, 0x95, 0xce, 0xa2, 0xe4,
+  0x3e, 0x1a, 0x4e, 0xdd, 0x47, 0x23, 0x09, 0x1c, 0xdb, 0xb7, 0xd8, 0xc9, 0x0a, 0xf1, 0x97, 0x59,
+  0x0a, 0x0a, 0x8c, 0x87, 0xa1, 0xf8, 0x67, 0x01, 0x32, 0x18, 0xc3, 0xf1, 0xed, 0xee, 0xf5, 0xa9,
+  0x3e, 0xf1, 0xa4, 0xe0, 0x4c, 0x1d, 0xe7, 0x5b, 0xac, 0xed, 0xc9, 0x1c, 0x37, 0x0e, 0xec, 0x84,
+  0x47, 0xb1, 0xe1, 0x75, 0x85, 0xdd, 0xc1, 0x46, 0x86, 0x2a, 0xd9, 0x9d, 0x39, 0x3b, 0x65, 0xb7,
+  0x99, 0x53, 0xa8, 0x31, 0xcb, 0x91, 0x1e, 0xc7, 0x20, 0xc0, 0xfb, 0x85, 0xba, 0x3a, 0xbd, 0xaa,
+  0x94, 0x13, 0xa5, 0xd5, 0xb6, 0xdd, 0xce, 0x5d, 0x3f, 0xc8, 0x84, 0x48, 0x2a, 0xa0, 0xa2, 0x61,
+  0x81, 0x90, 0xdb, 0x54, 0x47, 0x63, 0x81, 0x10, 0xda, 0xca, 0xcf, 0x69, 0xcc, 0x7a, 0x6c, 0x63,
+  0x7d, 0x7d, 0x1d, 0x42, 0xae, 0x3c, 0x89, 0xbe, 0x88, 0xd0, 0x5d, 0xf7, 0x0a, 0x85, 0xe8, 0x18,
+  0x3b, 0x2b, 0x32, 0xe8, 0x85, 0x3e, 0x06, 0xac, 0xa2, 0x3d, 0x03, 0x12, 0x88, 0xa2, 0xcb, 0x06,
+  0x52, 0x6a, 0xa6, 0x65, 0x19, 0x76, 0x45, 0xd8, 0xc2, 0x42, 0xe8, 0xa1, 0x81, 0x9c, 0xab, 0x82,
+  0x8d, 0x55, 0x13, 0x38, 0xe4, 0x4a, 0x5f, 0x81, 0x0d, 0x43, 0x4c, 0x77, 0x98, 0x8b, 0x23, 0x08,
+  0x4f, 0x7a, 0xe4, 0x39, 0x10, 0xd9, 0x1d, 0xb0, 0x47, 0x76, 0xdd, 0xef, 0x9f, 0xb6, 0xc8, 0x65,
+  0xc0, 0x47, 0xc1, 0xc2, 0x83, 0x71, 0xb7, 0x35, 0x1d, 0x46, 0xca, 0x6e, 0x0f, 0x7b, 0x84, 0x99,
+  0x4c, 0x55, 0x97, 0x65, 0xc2, 0x4e, 0xb5, 0x09, 0x94, 0xb3, 0x86, 0x1b, 0xe6, 0x8e, 0xf9, 0x97,
+  0x16, 0x02, 0x8c, 0xaf, 0xdb, 0x38, 0x1e, 0x6a, 0x64, 0x3f, 0xe6, 0xd9, 0x78, 0x0b, 0x82, 0xf9,
+  0x97, 0x8a, 0x1e, 0xc7, 0x29, 0x5f, 0x24, 0x7c, 0x00, 0x26, 0x00, 0x22, 0x60, 0xa0, 0x3f, 0x02,
+  0x9d, 0xb8, 0x0d, 0x28, 0xe1, 0xff, 0x54, 0x69, 0xf9, 0x4c, 0x06, 0x3c, 0x16, 0x7d, 0x72, 0x2d,
+  0xba, 0xbf, 0x9c, 0x44, 0x26, 0xc2, 0xa1, 0x23, 0xda, 0xcf, 0xc3, 0x48, 0xb2, 0x3c, 0x01, 0x7f,
+  0xcd, 0xf2, 0x44, 0x6d, 0xb5, 0xb7, 0xa9, 0xe6, 0x09, 0xf7, 0x28, 0x52, 0x69, 0xcc, 0xa7, 0x15,
+  0x4e, 0x68, 0xc6, 0xfe, 0x10, 0x62, 0xbb, 0x38, 0x98, 0x6a, 0x01, 0x8c, 0x1f, 0xb0, 0x18, 0x15,
+  0x4a, 0x53, 0xa8, 0x0d, 0x24, 0x30, 0x8b, 0x6f, 0x66, 0x6f, 0x01, 0x3b, 0x07, 0x8d, 0xe9, 0x8c,
+  0x27, 0x6a, 0x38, 0x8f, 0x55, 0xce, 0x1b, 0x3c, 0xdc, 0xff, 0x04, 0x89, 0xaa, 0xc5, 0xdb, 0xab,
+  0x7e, 0x3e, 0x18, 0x47, 0x1a, 0x0c, 0xa1, 0x60, 0xaa, 0xfc, 0x04, 0x4b, 0x5b, 0x88, 0x7b, 0x28,
+  0xc7, 0x69, 0x2c, 0x08, 0x37, 0xb0, 0x9f, 0x48, 0xff, 0x06, 0x77, 0x8c, 0xd0, 0x79, 0xe6, 0x37,
+  0xd1, 0x35, 0x0c, 0x2c, 0x04, 0x0f, 0x3b, 0x05, 0xfa, 0x86, 0xdc, 0x2c, 0xae, 0x85, 0x1a, 0x76,
+  0x49, 0x73, 0x07, 0xb9, 0xd6, 0xe0, 0x92, 0x60, 0xaf, 0xaa, 0xed, 0x2c, 0xe5, 0x92, 0x28, 0x49,
+  0x73, 0x7d, 0x06, 0xc7, 0x98, 0x04, 0x53, 0x23, 0x70, 0xcb, 0x46, 0x4a, 0x34, 0x98, 0x3a, 0x9d,
+  0xc3, 0xf4, 0x2a, 0xdd, 0x30, 0x72, 0x2f, 0x77, 0x67, 0x77, 0xe3, 0x75, 0xef, 0xe5, 0xcb, 0xde,
+  0xab, 0xf5, 0x1e, 0x98, 0x40, 0x6f, 0x0f, 0xfe, 0x41, 0x83, 0x5a, 0xac, 0xb8, 0xb7, 0x91, 0xd2,
+  0xf2, 0x1e, 0xbe, 0xfc, 0x4f, 0x32, 0x4a, 0x5c, 0x07, 0x74, 0xe6, 0x78, 0xc4, 0xf4, 0x3b, 0x31,
+  0x60, 0xe0, 0xff, 0x42, 0xd7, 0xda, 0x98, 0x88, 0x81, 0x4f, 0x53, 0xd7, 0xe2, 0x6f, 0xb9, 0x50,
+  0x68, 0xf7, 0x99, 0xfd, 0xea, 0x36, 0x71, 0x12, 0xa9, 0xcf, 0x65, 0x08, 0x86, 0x8d, 0x2a, 0x86,
+  0x01, 0x1b, 0xdb, 0x51, 0x0b, 0x6b, 0x80, 0x26, 0xd3, 0x87, 0x48, 0x88, 0x66, 0xa3, 0xe0, 0x97,
+  0xb9, 0xb3, 0xd0, 0xdb, 0x04, 0x0f, 0x28, 0x13, 0xb0, 0x67, 0x88, 0x58, 0x79, 0x63, 0xec, 0x75,
+  0xd9, 0x88, 0x27, 0x61, 0x5c, 0x9b, 0x0e, 0x2e, 0xb3, 0x53, 0x0b, 0x94, 0x88, 0x50, 0x18, 0xbe,
+  0x6d, 0x22, 0x90, 0xee, 0xde, 0xde, 0xdc, 0x5c, 0xb5, 0x44, 0xcc, 0x56, 0x4b, 0x67, 0xfd, 0x94,
+  0x6c, 0x81, 0x35, 0x06, 0xcc, 0x4d, 0x05, 0x7f, 0x68, 0x62, 0xe2, 0xf8, 0xb0, 0x81, 0xed, 0x75,
+  0xdb, 0xdb, 0xe4, 0x24, 0xd6, 0x83, 0x10, 0xe9, 0x1a, 0x8f, 0xa3, 0xcf, 0x62, 0x06, 0xfc, 0x89,
+  0x22, 0x1b, 0x72, 0x61, 0xbe, 0x5a, 0x60, 0x3c, 0x6b, 0x99, 0x23, 0x93, 0xe5, 0x17, 0xca, 0x72,
+  0x2d, 0x54, 0x0a, 0x3b, 0xd5, 0xa6, 0xf0, 0xaa, 0xb7, 0xb9, 0x8e, 0x96, 0xb0, 0x89, 0x96, 0xb0,
+  0x39, 0x63, 0x09, 0x66, 0x1b, 0xb3, 0x62, 0xb1, 0x21, 0x74, 0xd9, 0xbc, 0x06, 0xcb, 0x3d, 0x6a,
+  0xcf, 0xbc, 0xf8, 0x73, 0xbf, 0x8e, 0xff, 0x5a, 0x66, 0xfc, 0x5e, 0xf8, 0xc9, 0x67, 0xf5, 0x2e,
+  0x8b, 0x28, 0x28, 0x4c, 0xe8, 0xb7, 0x3b, 0x8b, 0x31, 0x8c, 0x73, 0x35, 0x42, 0x38, 0x18, 0x94,
+  0x86, 0xd8, 0xa4, 0x98, 0x9d, 0x99, 0xc3, 0x54, 0x0f, 0x11, 0x7a, 0x54, 0x81, 0xe7, 0x0f, 0x07,
+  0x7c, 0x0f, 0xae, 0x67, 0xa7, 0x66, 0x10, 0xc3, 0x28, 0xd3, 0x53, 0x0c, 0xec, 0x90, 0xe6, 0x42,
+  0x94, 0x01, 0xa2, 0x36, 0xaa, 0xd3, 0x39, 0xa3, 0x84, 0xd9, 0x74, 0x8e, 0xd3, 0x91, 0x99, 0x3f,
+  0x88, 0x65, 0xf0, 0x50, 0xb2, 0x3c, 0xc0, 0x41, 0xc5, 0x78, 0x0c, 0xfe, 0xa6, 0xf4, 0x92, 0x75,
+  0x67, 0x06, 0x38, 0x1b, 0x8a, 0x17, 0x63, 0x3d, 0x2d, 0x2a, 0x9f, 0x82, 0x85, 0xd6, 0xd7, 0xa6,
+  0x0a, 0x46, 0x22, 0xcc, 0xc1, 0x66, 0xfd, 0x08, 0xe6, 0xaf, 0x44, 0x36, 0x8e, 0xe2, 0xd8, 0x5c,
+  0xa3, 0xf5, 0x25, 0xba, 0xe1, 0x15, 0x7f, 0x80, 0xa5, 0xbe, 0xef, 0xcf, 0xac, 0xf9, 0x24, 0x07,
+  0x0a, 0x4e, 0x2d, 0x75, 0x3f, 0xe1, 0x55, 0x7f, 0xf7, 0x8b, 0x1c, 0x00, 0xe1, 0x4f, 0x7e, 0x02,
+  0xbe, 0x5f, 0x6c, 0xd1, 0x27, 0x05, 0x78, 0x86, 0xff, 0x9a, 0xd3, 0x8e, 0x4d, 0x74, 0x21, 0x18,
+  0x8c, 0x5b, 0xc1, 0xc6, 0x60, 0x00, 0x6e, 0x09, 0xbd, 0xce, 0x13, 0x6b, 0x07, 0x5e, 0x19, 0x86,
+  0x06, 0xf9, 0x10, 0xe2, 0xf6, 0xe2, 0x70, 0x63, 0x60, 0x6f, 0x05, 0x4f, 0xd1, 0x9d, 0x21, 0x51,
+  0x4c, 0x99, 0x3b, 0xe1, 0x73, 0x21, 0x34, 0x16, 0xf7, 0x3c, 0x98, 0xf6, 0x53, 0xd4, 0x7f, 0x79,
+  0xb3, 0x80, 0xf3, 0x0c, 0x21, 0x78, 0xce, 0x93, 0x15, 0xc2, 0xd2, 0xbb, 0xeb, 0x7c, 0xb0, 0xc6,
+  0xbb, 0x33, 0xc8, 0xf6, 0x1c, 0x6f, 0x45, 0xd6, 0xa6, 0xa6, 0x4a, 0x8b, 0xf1, 0xc2, 0x34, 0x1f,
+  0xb3, 0x20, 0x93, 0x4d, 0x2d, 0x4c, 0x78, 0xe7, 0x93, 0x27, 0xcc, 0xcd, 0x89, 0xa5, 0x11, 0x57,
+  0xdf, 0x91, 0x9f, 0x7f, 0x2d, 0x41, 0x85, 0x48, 0x33, 0x8c, 0xee, 0xf3, 0x6c, 0x55, 0x96, 0x5a,
+  0xd8, 0x2c, 0xd0, 0xe4, 0x73, 0x47, 0xfb, 0x7f, 0xfd, 0x78, 0xb1, 0x7f, 0x7e, 0xdc, 0xc7, 0xa4,
+  0xce, 0xe9, 0xe7, 0x09, 0xb8, 0x85, 0x73, 0x2e, 0xe9, 0xe7, 0x26, 0x17, 0xf8, 0xf3, 0x0e, 0xaa,
+  0x34, 0x1c, 0x8d, 0x72, 0xfc, 0x39, 0xc9, 0x22, 0xfc, 0xe9, 0x73, 0xed, 0x7c, 0xa8, 0x4b, 0x4a,
+  0xac, 0x44, 0x13, 0x14, 0xd5, 0x1a, 0x6b, 0xe2, 0xf9, 0x30, 0x09, 0x32, 0x64, 0xda, 0xdd, 0x04,
+  0xf4, 0x75, 0xa7, 0x59, 0x08, 0x87, 0x02, 0xee, 0xb8, 0x68, 0x20, 0x8e, 0xf8, 0x54, 0x81, 0x5a,
+  0xa6, 0xca, 0xab, 0x54, 0x34, 0x85, 0xca, 0x14, 0x2a, 0xea, 0x75, 0x8f, 0x99, 0xa2, 0x82, 0x39,
+  0x32, 0x09, 0x84, 0xb3, 0xdd, 0x06, 0x6f, 0x6c, 0xfe, 0x5c, 0x23, 0x88, 0xcf, 0x22, 0x9b, 0x32,
+  0x80, 0xcd, 0x62, 0xbd, 0xde, 0xac, 0x91, 0x26, 0x42, 0x3c, 0x20, 0x60, 0x0e, 0xe7, 0x55, 0x1b,
+  0x07, 0x22, 0x82, 0xaa, 0x2a, 0x9a, 0x5a, 0x3b, 0xfe, 0x30, 0x8a, 0xa1, 0xf4, 0x71, 0xdd, 0x8f,
+  0x5d, 0x16, 0x51, 0x77, 0x80, 0x28, 0xfc, 0xc8, 0xdc, 0x0d, 0xb6, 0xb3, 0x03, 0x53, 0x5e, 0x19,
+  0x12, 0x9d, 0x76, 0x8a, 0x4d, 0x49, 0x92, 0xbd, 0x0a, 0x5d, 0xac, 0x62, 0x50, 0x54, 0x4b, 0xdd,
+  0xd8, 0x0e, 0x61, 0xfc, 0xdf, 0x6a, 0x24, 0xda, 0x72, 0x51, 0x7d, 0x54, 0x59, 0xa4, 0x49, 0xf8,
+  0x49, 0x19, 0x0e, 0x15, 0x10, 0x8e, 0xc7, 0xf4, 0x28, 0x93, 0x13, 0x46, 0x60, 0xc8, 0x4f, 0x14,
+  0xc4, 0xa8, 0x6f, 0xaa, 0x57, 0x50, 0xa2, 0xef, 0x2b, 0x8f, 0x2d, 0xbb, 0x2e, 0xa9, 0x1a, 0x62,
+  0xff, 0x8d, 0xb9, 0xbf, 0xdc, 0x58, 0xf2, 0x90, 0x32, 0x5e, 0x88, 0x32, 0x2f, 0x21, 0x48, 0xb6,
+  0x95, 0x5d, 0x43, 0x1b, 0x05, 0x8d, 0xd1, 0xef, 0xb2, 0x7a, 0x06, 0xe4, 0xc4, 0x5e, 0x48, 0x9d,
+  0xd0, 0x9a, 0x40, 0xd8, 0xc2, 0x99, 0xc0, 0x42, 0xc0, 0xe1, 0x26, 0x69, 0x6e, 0x04, 0x71, 0xfe,
+  0xf5, 0x34, 0x7a, 0xad, 0x36, 0xa6, 0xbb, 0xe7, 0x8f, 0xe0, 0x13, 0xb0, 0x68, 0x24, 0xf3, 0xcc,
+  0x2b, 0xb6, 0xca, 0xe1, 0x38, 0x4a, 0x72, 0x2d, 0x3c, 0x2a, 0x62, 0x9a, 0x8e, 0x01, 0xf1, 0x0b,
+  0x5d, 0xa3, 0x60, 0x77, 0xec, 0x45, 0x07, 0x16, 0xf3, 0x46, 0x4a, 0xef, 0x5c, 0x5e, 0xd0, 0xad,
+  0x75, 0x79, 0x72, 0xe2, 0x14, 0x08, 0xc2, 0xbb, 0xce, 0x54, 0x2b, 0xf4, 0x85, 0x7c, 0xd5, 0xd5,
+  0x8a, 0x2d, 0x0e, 0x50, 0x0e, 0x4b, 0x6d, 0x67, 0x60, 0xd2, 0x4d, 0x70, 0x2e, 0xb0, 0xa3, 0x87,
+  0x5d, 0xa7, 0x65, 0xa7, 0x8f, 0x11, 0xc5, 0x0f, 0xa8, 0xe2, 0x42, 0x58, 0x0d, 0x57, 0xfe, 0x3d,
+  0xde, 0x35, 0x3a, 0xcb, 0x45, 0xe1, 0x39, 0x7b, 0x97, 0x49, 0xef, 0x72, 0x38, 0xdc, 0xe9, 0x19,
+  0x12, 0x7b, 0x48, 0xcf, 0xf2, 0x0a, 0x0c, 0x7c, 0x13, 0x65, 0x64, 0x15, 0x87, 0xcf, 0x0c, 0xff,
+  0x05, 0x52, 0x6f, 0x0a, 0x73, 0x9b, 0xe0, 0x17, 0x89, 0xd1, 0x2f, 0xa5, 0x72, 0x8a, 0xc6, 0xce,
+  0x28, 0x9f, 0xb7, 0x50, 0x9e, 0x50, 0x60, 0xca, 0x4e, 0xc6, 0xe0, 0xda, 0xfd, 0x80, 0xf8, 0x11,
+  0xcd, 0xd6, 0x04, 0x4c, 0x0c, 0xaf, 0x5d, 0x21, 0x91, 0xf2, 0xef, 0x22, 0xbc, 0x4d, 0x74, 0x14,
+  0x93, 0x9f, 0x82, 0x71, 0xf8, 0x29, 0xe4, 0x1b, 0x6e, 0xdb, 0x70, 0x27, 0x3c, 0x4b, 0xe0, 0x84,
+  0x7f, 0xd8, 0xeb, 0x9b, 0x05, 0x90, 0x73, 0xc0, 0x0a, 0x10, 0x64, 0xe6, 0x7a, 0x6f, 0x90, 0x9b,
+  0x33, 0x12, 0xb4, 0xe8, 0xd2, 0x50, 0x2a, 0xd3, 0x27, 0x73, 0x5e, 0xed, 0x57, 0x67, 0x90, 0x2b,
+  0xcc, 0x78, 0x15, 0xb1, 0x19, 0x8b, 0xe4, 0x9e, 0x0a, 0x56, 0x1a, 0x35, 0xaf, 0x38, 0xd4, 0xd2,
+  0x85, 0x34, 0x91, 0x48, 0x39, 0x73, 0x4d, 0x00, 0x1e, 0x1a, 0x9f, 0x69, 0xf4, 0x9e, 0xd0, 0x40,
+  0x81, 0x6e, 0xca, 0x33, 0x25, 0x4e, 0x13, 0xed, 0xae, 0xe6, 0xe8, 0x2d, 0x60, 0x97, 0xbd, 0x0d,
+  0xaf, 0xbc, 0x12, 0x8c, 0x51, 0x3f, 0x9d, 0xc8, 0x39, 0xe1, 0xcf, 0x91, 0x31, 0x71, 0xfa, 0xa9,
+  0x44, 0xd0, 0x6d, 0x1a, 0x24, 0xbe, 0x3d, 0x40, 0x2d, 0xbf, 0x60, 0x71, 0x05, 0x33, 0x1e, 0xdb,
+  0x72, 0xdf, 0x65, 0xce, 0x6b, 0x5c, 0xb7, 0x0e, 0x69, 0x6d, 0x2f, 0x40, 0x12, 0x5d, 0xab, 0xa3,
+  0x2e, 0x09, 0x39, 0x73, 0x28, 0x4d, 0xf3, 0x8d, 0xc2, 0x32, 0x98, 0xdd, 0x99, 0x60, 0xf6, 0x26,
+  0x0a, 0x77, 0x9f, 0x83, 0x27, 0x41, 0x1e, 0xc8, 0x1e, 0xab, 0x4b, 0xe3, 0xe8, 0xf8, 0xec, 0xf8,
+  0xe6, 0xd8, 0xf9, 0xad, 0xb1, 0xd3, 0x18, 0x6b, 0x6d, 0x09, 0x6d, 0x86, 0x0d, 0xb4, 0x8c, 0x01,
+  0xed, 0x85, 0x5a, 0xa6, 0x4b, 0x97, 0x01, 0xac, 0xb9, 0xc8, 0x1c, 0xea, 0xf5, 0xe9, 0xc5, 0x1f,
+  0x6f, 0x2e, 0x2f, 0x8e, 0x3f, 0x5e, 0xef, 0xdf, 0x1c, 0xc3, 0xe9, 0x6e, 0xbc, 0x06, 0xcf, 0xd8,
+  0x9e, 0x05, 0x9e, 0xef, 0xff, 0xe5, 0x63, 0xff, 0xf8, 0x10, 0xe0, 0x2f, 0x01, 0xc8, 0xd5, 0x34,
+  0x09, 0x58, 0xb5, 0x69, 0x9e, 0xa2, 0x34, 0xd7, 0xe0, 0x3d, 0xe0, 0xc7, 0xa2, 0x61, 0xba, 0x70,
+  0x4f, 0x8b, 0x55, 0x4d, 0xd3, 0xcc, 0x2e, 0x39, 0x01, 0x3c, 0x38, 0x7b, 0x44, 0x57, 0xef, 0xd7,
+  0xab, 0x4c, 0xa6, 0xbc, 0x0c, 0xbf, 0x4e, 0xa0, 0x34, 0x1f, 0xdb, 0x77, 0x45, 0x42, 0xc8, 0x85,
+  0x21, 0xd0, 0x72, 0xcf, 0xaf, 0x35, 0x55, 0x83, 0x91, 0x94, 0xf0, 0xc3, 0x89, 0xf7, 0x45, 0x4d,
+  0x55, 0x0d, 0xe9, 0xcd, 0x13, 0x28, 0x57, 0x51, 0x09, 0x92, 0x05, 0x48, 0x89, 0xb0, 0x5c, 0x82,
+  0x54, 0xbf, 0x26, 0x68, 0x3d, 0x4a, 0x50, 0xdf, 0x1d, 0xef, 0xb3, 0x09, 0x8f, 0x34, 0x5d, 0x66,
+  0xd4, 0xe1, 0xa1, 0x14, 0x03, 0x9f, 0x2c, 0x7c, 0x83, 0x42, 0x93, 0x10, 0xcc, 0xb8, 0x6b, 0x10,
+  0x91, 0x3b, 0x9f, 0x67, 0x19, 0x9f, 0x1e, 0x50, 0x82, 0x4e, 0x6f, 0x1b, 0x56, 0x6b, 0xd8, 0x97,
+  0x0a, 0x51, 0x6d, 0xe7, 0x90, 0x07, 0xe3, 0x85, 0xe6, 0xda, 0x6d, 0xfc, 0x30, 0xcf, 0x28, 0x4b,
+  0xe9, 0xce, 0x1d, 0x6c, 0xb5, 0x5a, 0x0e, 0x87, 0x71, 0x94, 0x08, 0xfb, 0x22, 0x71, 0x69, 0x46,
+  0x2d, 0x96, 0x36, 0xba, 0x86, 0x70, 0x20, 0xa2, 0xd8, 0x2d, 0x37, 0xfb, 0xa9, 0x6d, 0x47, 0x5e,
+  0x77, 0x66, 0x5c, 0x31, 0x07, 0xbe, 0x16, 0x20, 0x75, 0xbb, 0x8f, 0x1f, 0x64, 0x90, 0xad, 0x0b,
+  0x23, 0x44, 0x9f, 0x80, 0x2e, 0x20, 0x1b, 0x34, 0xdf, 0x14, 0x1f, 0x68, 0x00, 0x46, 0x80, 0x0a,
+  0x60, 0x8b, 0x78, 0xb7, 0xa4, 0x02, 0xde, 0x0e, 0x1a, 0x26, 0xd9, 0xea, 0xd5, 0x8a, 0x12, 0xde,
+  0x3a, 0x08, 0xca, 0x44, 0xe2, 0xbb, 0x92, 0x51, 0x60, 0xb9, 0x92, 0x90, 0xae, 0xa9, 0xc1, 0x45,
+  0xd1, 0xdf, 0x43, 0x1b, 0x3b, 0x84, 0x9a, 0x35, 0x11, 0x31, 0xe9, 0x7b, 0xbd, 0x22, 0x90, 0x06,
+  0x63, 0xab, 0x16, 0x08, 0x7e, 0x1b, 0xaf, 0xf7, 0x51, 0xfb, 0x2e, 0x52, 0xb5, 0xe1, 0x1e, 0x93,
+  0x6a, 0x99, 0x31, 0x17, 0x82, 0x05, 0xc3, 0x17, 0xac, 0xf5, 0x6d, 0xf8, 0xd9, 0x61, 0x0d, 0x0c,
+  0x98, 0x78, 0xf1, 0x02, 0x0d, 0x13, 0x48, 0xbd, 0x8f, 0x3e, 0x54, 0x47, 0xc4, 0xbf, 0xb8, 0x6b,
+  0xa5, 0x5a, 0xf1, 0xbc, 0xe0, 0x1b, 0x57, 0x01, 0x8a, 0xe7, 0x81, 0x6a, 0x5f, 0x6e, 0xfe, 0xfc,
+  0xfa, 0x67, 0xb4, 0xbd, 0xa7, 0x5b, 0xdd, 0x2d, 0xb9, 0xe4, 0x12, 0xa3, 0xa3, 0xac, 0xcb, 0x5a,
+  0x9c, 0x49, 0xcb, 0x4a, 0x3f, 0xfa, 0x9e, 0xcc, 0x57, 0x06, 0x5a, 0xe8, 0x35, 0x48, 0x76, 0x05,
+  0x1f, 0x37, 0x1e, 0x92, 0x82, 0xb1, 0x3d, 0x46, 0xba, 0xea, 0x16, 0x48, 0x30, 0x97, 0xf7, 0xaa,
+  0x3c, 0x08, 0x20, 0xcf, 0x75, 0xd8, 0x9b, 0xa5, 0x37, 0x40, 0x1f, 0x7b, 0xff, 0x55, 0xbd, 0x5d,
+  0x9a, 0xf5, 0xb9, 0x9a, 0x6b, 0x55, 0x43, 0x95, 0xad, 0xca, 0xb8, 0xcf, 0xb6, 0x96, 0x3f, 0xa9,
+  0x18, 0x7d, 0xb1, 0x21, 0x35, 0xea, 0x6b, 0x85, 0x15, 0x8c, 0x92, 0x6c, 0xe6, 0x2e, 0x0b, 0x27,
+  0x4f, 0xcd, 0xa1, 0x9b, 0x31, 0x1a, 0xab, 0xe0, 0x56, 0xb0, 0x6c, 0x9f, 0x41, 0x0f, 0xe1, 0x4e,
+  0xf3, 0x32, 0xa1, 0x73, 0x58, 0x78, 0x27, 0xad, 0x20, 0xe3, 0x7c, 0xfd, 0x3a, 0x5a, 0x51, 0x35,
+  0xcc, 0x06, 0xd6, 0x15, 0x0f, 0x53, 0xf5, 0xa9, 0x1c, 0x89, 0x21, 0xcf, 0x63, 0xcd, 0x06, 0x42,
+  0xa4, 0x50, 0xc7, 0x61, 0x1b, 0xa5, 0xa5, 0xcc, 0x99, 0xab, 0x6a, 0x24, 0x27, 0xef, 0x4c, 0xa9,
+  0x4e, 0xc7, 0xe8, 0xcd, 0x3f, 0x6b, 0x2c, 0xdb, 0xe8, 0x36, 0x85, 0x05, 0x22, 0x7c, 0x56, 0xd2,
+  0xc6, 0x5e, 0x37, 0xdd, 0xf7, 0x29, 0x52, 0xae, 0x1b, 0x19, 0xf5, 0x1c, 0x75, 0x69, 0x6e, 0xc4,
+  0x38, 0x15, 0x60, 0x2a, 0x50, 0x92, 0x57, 0x38, 0xba, 0x9e, 0x2b, 0xfe, 0xf3, 0xef, 0x43, 0x6a,
+  0x3b, 0xe5, 0xe3, 0x28, 0x8c, 0x74, 0xdd, 0x77, 0x1a, 0xd9, 0x09, 0x6a, 0xd8, 0xdc, 0x5d, 0x61,
+  0x37, 0xb3, 0x49, 0x22, 0xb5, 0x13, 0x05, 0x1b, 0x5d, 0xf1, 0x6f, 0x68, 0x69, 0xd8, 0x3e, 0xc5,
+  0xaa, 0x9e, 0x46, 0xc3, 0x68, 0x64, 0x1c, 0x97, 0xda, 0xe2, 0x1a, 0xb9, 0xd6, 0xaa, 0x3e, 0x74,
+  0x4b, 0xca, 0x79, 0x62, 0x65, 0x19, 0xa2, 0x7d, 0x90, 0x45, 0xcf, 0x9e, 0x01, 0x9a, 0xbc, 0xc0,
+  0xf7, 0xf3, 0x85, 0xeb, 0x8c, 0x7b, 0x38, 0xec, 0xd7, 0x5f, 0x59, 0xc9, 0x03, 0xdb, 0xa1, 0xfe,
+  0xc0, 0xe3, 0x6f, 0x12, 0x73, 0x95, 0x3f, 0xe2, 0x09, 0x2f, 0xf0, 0x47, 0x62, 0x0e, 0x18, 0xaf,
+  0x33, 0x29, 0x63, 0xcb, 0x8b, 0xf4, 0xc3, 0xd6, 0xd8, 0x06, 0xdc, 0x44, 0x14, 0x11, 0xea, 0x56,
+  0x4b, 0x23, 0x6d, 0xc1, 0x3d, 0xca, 0x45, 0xbf, 0x93, 0x0c, 0x8d, 0x08, 0x0c, 0xd4, 0x67, 0x03,
+  0x70, 0xbb, 0x41, 0x65, 0x18, 0xf8, 0x1d, 0x0f, 0x0d, 0x2e, 0x96, 0x86, 0x1a, 0x36, 0x5e, 0x59,
+  0xa9, 0x9f, 0xfc, 0x90, 0xbe, 0x42, 0xca, 0xbb, 0x27, 0x9d, 0xd4, 0xe2, 0x27, 0x4e, 0xe3, 0xd5,
+  0xd8, 0x2f, 0x07, 0xcb, 0x7e, 0x2c, 0x1a, 0xbd, 0x27, 0xf3, 0xb2, 0x74, 0x06, 0x90, 0x46, 0xd6,
+  0x88, 0xf7, 0x32, 0xa6, 0x2f, 0xef, 0x3f, 0x98, 0x74, 0x0e, 0x17, 0xda, 0x57, 0x4a, 0xfa, 0x0f,
+  0x1e, 0xf8, 0xc8, 0x35, 0x04, 0x1c, 0xc8, 0xc4, 0x09, 0xd5, 0x16, 0x85, 0xf5, 0xb3, 0x66, 0x63,
+  0x41, 0x71, 0xe7, 0x35, 0x88, 0xe0, 0xd3, 0x5d, 0x7b, 0x51, 0xf9, 0x84, 0x59, 0x81, 0xab, 0x07,
+  0x4b, 0xfb, 0xa8, 0x58, 0x03, 0xaa, 0x47, 0xc5, 0x16, 0x49, 0x25, 0x12, 0x25, 0xb3, 0x19, 0x4e,
+  0x68, 0xae, 0xe6, 0x84, 0x86, 0x55, 0x98, 0x60, 0x6f, 0xa0, 0x98, 0x5e, 0x5b, 0x73, 0x28, 0x5c,
+  0x74, 0x67, 0x90, 0x1a, 0xe1, 0xa8, 0xc2, 0xc3, 0xb0, 0xd4, 0xdc, 0x92, 0xb2, 0xfa, 0x5a, 0x5d,
+  0x55, 0x71, 0x67, 0x0b, 0xd8, 0x1a, 0xa7, 0x6c, 0x66, 0x2c, 0xe8, 0xfe, 0x35, 0xd9, 0xb5, 0x8f,
+  0x96, 0x96, 0x11, 0xb3, 0x12, 0x6b, 0x22, 0xac, 0xaa, 0x0c, 0x85, 0xa2, 0x0d, 0x5c, 0xda, 0xf9,
+  0x68, 0xe0, 0x50, 0xcb, 0x2b, 0xb9, 0xa7, 0x2e, 0xc8, 0x1a, 0x25, 0x83, 0xf0, 0xa7, 0xec, 0xed,
+  0xaf, 0xae, 0xac, 0x91, 0xca, 0xc2, 0xa0, 0x68, 0x98, 0x6e, 0x47, 0xd7, 0x56, 0xed, 0x03, 0x22,
+  0x1e, 0x7f, 0x06, 0x3a, 0xaa, 0x61, 0x4d, 0x82, 0x26, 0x6c, 0xe2, 0x46, 0x50, 0x9b, 0x66, 0x3a,
+  0x3d, 0x03, 0x42, 0x2a, 0xe6, 0xcb, 0x97, 0x89, 0x6d, 0xb0, 0x01, 0xba, 0x68, 0x36, 0x9d, 0x6c,
+  0xca, 0x44, 0xed, 0x3c, 0x2a, 0x7f, 0x5d, 0xe1, 0x5b, 0xd7, 0xbb, 0x1c, 0xe0, 0x5b, 0x0f, 0xbe,
+  0xb2, 0x45, 0xf7, 0x89, 0x6b, 0x1e, 0x85, 0x2c, 0xa8, 0x72, 0x63, 0xeb, 0x58, 0xec, 0xc7, 0x1f,
+  0x59, 0x73, 0x8c, 0xfd, 0xe7, 0x23, 0x7b, 0xf3, 0xcd, 0x3a, 0x75, 0x89, 0x43, 0x22, 0x36, 0xdd,
+  0x04, 0xc6, 0x38, 0xd5, 0xf8, 0xdf, 0x02, 0x70, 0x9a, 0x8d, 0x56, 0x1b, 0xe5, 0x58, 0xb5, 0x1e,
+  0xb6, 0xff, 0x07, 0x4a, 0x9b, 0x37, 0x7e, 0x54, 0x25, 0x00, 0x00
+};
+
+static const uint8_t WEB_ASSET_INDEX_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0xc1, 0x6e, 0x13, 0x31,
+  0x10, 0xbd, 0xf3, 0x15, 0xe6, 0xb4, 0x80, 0x68, 0xb7, 0x49, 0x95, 0x26, 0x91, 0xb2, 0x41, 0x51,
+  0xd3, 0x8a, 0x0a, 0xaa, 0x46, 0x4d, 0x51, 0xc5, 0xd1, 0x59, 0xcf, 0x36, 0xa6, 0x8e, 0x77, 0x65,
+  0x7b, 0x93, 0x2e, 0x9f, 0x80, 0x90, 0x2a, 0xd4, 0xde, 0x11, 0x12, 0x1f, 0xc0, 0x91, 0xef, 0xe1,
+  0x07, 0xe0, 0x13, 0x18, 0xaf, 0x77, 0x9b, 0x74, 0x9b, 0xa4, 0xcd, 0xc9, 0xf2, 0xf8, 0xcd, 0x9b,
+  0x79, 0x33, 0xb3, 0xf6, 0x76, 0x9e, 0xf7, 0x4f, 0xf6, 0xcf, 0x3e, 0x0e, 0x0e, 0xc8, 0xd8, 0x4c,
+  0x44, 0xf7, 0x59, 0xa7, 0x5c, 0x80, 0x32, 0x5c, 0x26, 0x60, 0x28, 0x09, 0xc7, 0x54, 0x69, 0x30,
+  0x81, 0x97, 0x9a, 0x68, 0xab, 0xe5, 0x95, 0x66, 0x49, 0x27, 0x10, 0x78, 0x53, 0x0e, 0xb3, 0x24,
+  0x56, 0xc6, 0x23, 0x61, 0x2c, 0x0d, 0x48, 0x84, 0xcd, 0x38, 0x33, 0xe3, 0x80, 0xc1, 0x94, 0x87,
+  0xb0, 0x95, 0x6f, 0x5e, 0x73, 0xc9, 0x0d, 0xa7, 0x62, 0x4b, 0x87, 0x54, 0x40, 0x50, 0xb3, 0x1c,
+  0x86, 0x1b, 0x01, 0xdd, 0x83, 0xe1, 0x80, 0x9c, 0x81, 0x9a, 0x70, 0x49, 0x05, 0xd9, 0x47, 0x06,
+  0x15, 0x8b, 0x8e, 0xef, 0xce, 0x9e, 0x75, 0x04, 0x97, 0x97, 0x44, 0x81, 0x08, 0x3c, 0x6d, 0x32,
+  0x01, 0x7a, 0x0c, 0x80, 0x81, 0xc6, 0x0a, 0xa2, 0xc0, 0xf3, 0x73, 0xd3, 0x76, 0xa8, 0xf5, 0x9b,
+  0x69, 0xd0, 0x8a, 0xa2, 0xa8, 0x5d, 0x6f, 0x8f, 0xf6, 0x58, 0xad, 0xc5, 0x9a, 0xad, 0x91, 0x0d,
+  0xe0, 0x17, 0x1a, 0x46, 0x31, 0xcb, 0x70, 0x61, 0x7c, 0x4a, 0x42, 0x41, 0xb5, 0x0e, 0x3c, 0x9b,
+  0x29, 0xe5, 0x12, 0x94, 0x85, 0x8d, 0x6b, 0xf7, 0x92, 0x40, 0xb7, 0xda, 0x7d, 0xb4, 0x86, 0xd0,
+  0xf0, 0x58, 0xe6, 0xd8, 0x7a, 0xf7, 0xdf, 0xf7, 0x9b, 0x1f, 0xe4, 0x9c, 0x1f, 0x72, 0x9b, 0x6d,
+  0xc4, 0x2f, 0x52, 0x45, 0xed, 0x29, 0xba, 0xd5, 0x11, 0xc0, 0x65, 0x92, 0x1a, 0x62, 0xb2, 0x04,
+  0x2b, 0x63, 0xe0, 0x0a, 0x93, 0xe5, 0x0c, 0x19, 0x34, 0x67, 0x1e, 0x49, 0x04, 0x0d, 0x61, 0x1c,
+  0x0b, 0x06, 0x2a, 0xf0, 0x86, 0xc3, 0xa3, 0xbe, 0x57, 0x71, 0x48, 0x30, 0xdc, 0x2c, 0x56, 0xcc,
+  0x39, 0xcd, 0x77, 0xf7, 0x1c, 0x07, 0xa5, 0xd9, 0x2a, 0x4b, 0x8d, 0x89, 0x25, 0x89, 0x65, 0x28,
+  0x78, 0x78, 0x99, 0xeb, 0x92, 0x98, 0xac, 0xcd, 0xee, 0xc5, 0x4b, 0xaf, 0xbb, 0xef, 0xb6, 0x1d,
+  0xdf, 0xe1, 0x2a, 0xaa, 0x0c, 0x35, 0xa9, 0x76, 0xa1, 0x66, 0x3c, 0xe2, 0x43, 0xb7, 0xef, 0x76,
+  0x7c, 0x04, 0xd9, 0xea, 0xb9, 0x65, 0x4d, 0x1d, 0x6e, 0xbf, 0x91, 0x73, 0xa0, 0x66, 0x0c, 0x8a,
+  0xf4, 0x06, 0x47, 0xe4, 0x1d, 0x64, 0x6b, 0x8b, 0x40, 0x13, 0x8e, 0x90, 0x8a, 0x9a, 0x93, 0x04,
+  0x64, 0x41, 0x72, 0x4c, 0x93, 0x92, 0x67, 0x99, 0x36, 0x1c, 0xc0, 0x5e, 0xce, 0x60, 0x95, 0x0d,
+  0xe9, 0x14, 0xe6, 0x41, 0x1f, 0x93, 0xe7, 0x22, 0x6f, 0x2e, 0xf0, 0xe6, 0x0b, 0x19, 0x66, 0xda,
+  0xc0, 0x84, 0x38, 0xdf, 0x42, 0xde, 0x8a, 0x28, 0x82, 0x4f, 0xa1, 0x1a, 0xa3, 0x2a, 0xe2, 0x02,
+  0x8c, 0x83, 0x58, 0x11, 0xa7, 0x10, 0x29, 0x1c, 0x69, 0xc2, 0xf0, 0x63, 0xe2, 0x42, 0x3f, 0xae,
+  0x43, 0xe7, 0xc9, 0x6c, 0xaa, 0xe3, 0xcf, 0xf5, 0x2f, 0xd2, 0x13, 0x54, 0xa1, 0x0a, 0x30, 0x86,
+  0xcb, 0x0b, 0xbd, 0xa4, 0x4d, 0x32, 0x9d, 0x8c, 0xf0, 0x73, 0x70, 0xe5, 0xb2, 0xe0, 0xb7, 0x71,
+  0x8a, 0x5b, 0xfc, 0x22, 0x02, 0x6f, 0x07, 0x57, 0x7a, 0x15, 0x78, 0xf5, 0xdd, 0x4a, 0xf3, 0x1c,
+  0x66, 0x4a, 0x45, 0x8a, 0x0c, 0x6d, 0xef, 0x31, 0xca, 0x63, 0x2e, 0x53, 0x03, 0x15, 0xd2, 0x46,
+  0xbb, 0x42, 0x5a, 0xa2, 0x0a, 0xda, 0x1d, 0x4b, 0xab, 0x41, 0xa0, 0xa4, 0x39, 0x53, 0x9f, 0x66,
+  0xda, 0xda, 0xe3, 0xc4, 0xea, 0x2c, 0xa1, 0xb5, 0x7a, 0xd3, 0xeb, 0x1e, 0x4c, 0x41, 0x65, 0x84,
+  0x51, 0x1c, 0x0b, 0x77, 0xfa, 0x00, 0xb6, 0x57, 0xf7, 0xba, 0xe7, 0x00, 0x97, 0x88, 0xd1, 0xab,
+  0x41, 0x0d, 0x07, 0x02, 0xc9, 0x56, 0x83, 0x30, 0xb7, 0x13, 0x19, 0xc2, 0xc2, 0xb9, 0xef, 0x32,
+  0x5d, 0xd2, 0x79, 0xca, 0x58, 0xde, 0x04, 0xdb, 0xf8, 0x1e, 0x63, 0xae, 0x23, 0x0b, 0x2d, 0x7f,
+  0x30, 0xee, 0x32, 0x8e, 0x3f, 0xc3, 0x9d, 0xcb, 0x30, 0xdf, 0xae, 0xc3, 0x9b, 0x38, 0x99, 0xa3,
+  0x71, 0xf3, 0x84, 0xcf, 0xc2, 0xc2, 0xab, 0xd3, 0xb4, 0x0e, 0xfb, 0x9e, 0x6b, 0xb3, 0xd1, 0x05,
+  0x71, 0x4b, 0x4e, 0x71, 0xde, 0x30, 0x09, 0x58, 0x32, 0x72, 0x11, 0x17, 0xe0, 0xc8, 0x55, 0x01,
+  0x3a, 0xcc, 0x2d, 0x34, 0x0c, 0x21, 0xc1, 0x57, 0x84, 0xa6, 0x8c, 0xc7, 0xfe, 0xab, 0x65, 0x77,
+  0x41, 0x9a, 0x88, 0x98, 0xb2, 0x92, 0xdb, 0x2a, 0xfe, 0x90, 0x5b, 0xd6, 0xd4, 0x07, 0x67, 0x2c,
+  0x5b, 0x74, 0x18, 0x08, 0x9a, 0xad, 0x81, 0x33, 0xec, 0xa3, 0x81, 0x45, 0x87, 0x7e, 0x6e, 0x79,
+  0xbc, 0xaa, 0xa5, 0x98, 0xcd, 0xaf, 0x9b, 0xaf, 0x3f, 0xff, 0xfe, 0xbe, 0xbe, 0xbb, 0x52, 0xfb,
+  0xd4, 0xd0, 0xa2, 0x6a, 0x0f, 0xe5, 0x33, 0x6a, 0xa0, 0x00, 0x3a, 0xf5, 0xd6, 0x50, 0xba, 0x3e,
+  0xe1, 0xbe, 0x77, 0xc0, 0x15, 0x29, 0x16, 0x8b, 0x0e, 0x15, 0x4f, 0x0c, 0xd1, 0x2a, 0xc4, 0xb7,
+  0x96, 0x26, 0xc9, 0xf6, 0x27, 0xfb, 0xd0, 0x36, 0x22, 0xd6, 0x6c, 0xec, 0xec, 0xb6, 0x43, 0x1a,
+  0x35, 0x1a, 0xb4, 0xd6, 0xb4, 0xde, 0x0e, 0x69, 0x3d, 0x8b, 0xa7, 0xd6, 0xcf, 0x7f, 0x22, 0xfe,
+  0x03, 0x72, 0x78, 0x1a, 0xd2, 0x5b, 0x08, 0x00, 0x00
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/style.css", "text/css; charset=utf-8", "\"8fff929b6d18d78b\"", "public, max-age=31536000, immutable", WEB_ASSET_STYLE_CSS, 451, 1166},
+  {"/app.js", "application/javascript; charset=utf-8", "\"5fd75039caf55a17\"", "public, max-age=31536000, immutable", WEB_ASSET_APP_JS, 3099, 11368},
+  {"/", "text/html; charset=utf-8", "\"0b1482a9802947ef\"", "no-cache", WEB_ASSET_INDEX_HTML, 793, 2425}
+};
+#define WEB_ASSET_COUNT 3
+
+#endif // WEB_ASSETS_H
\ No newline at end of file
@@ -0,0 +1,624 @@
+#include "widgets.h"
+#include <stdarg.h>
+
+// Злиття вигідне, якщо об'єднання додає не більше стількох пікселів,
+// ніж окремі вікна (кожне вікно коштує CASET/RASET/RAMWR)
+#define DIRTY_MERGE_SLACK 256
+
+// ============= RECT =============
+bool Rect::intersects(const Rect& other) const {
+  return x < other.x + other.w && other.x < x + w &&
+         y < other.y + other.h && other.y < y + h;
+}
+
+Rect Rect::unite(const Rect& other) const {
+  int16_t left = x < other.x ? x : other.x;
+  int16_t top = y < other.y ? y : other.y;
+  int16_t right = (x + w) > (other.x + other.w) ? (x + w) : (other.x + other.w);
+  int16_t bottom = (y + h) > (other.y + other.h) ? (y + h) : (other.y + other.h);
+  Rect result = {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+  return result;
+}
+
+// ============= DIRTY REGION =============
+void DirtyRegion::removeAt(uint8_t index) {
+  for (uint8_t i = index; i + 1 < count; i++) {
+    rects[i] = rects[i + 1];
+  }
+  count--;
+}
+
+void DirtyRegion::add(const Rect& rect) {
+  if (rect.isEmpty()) return;
+
+  Rect merged = rect;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (uint8_t i = 0; i < count; i++) {
+      Rect united = merged.unite(rects[i]);
+      if (merged.intersects(rects[i]) ||
+          united.area() <= merged.area() + rects[i].area() + DIRTY_MERGE_SLACK) {
+        merged = united;
+        removeAt(i);
+        changed = true;
+        break;
+      }
+    }
+  }
+
+  if (count < DIRTY_RECT_MAX) {
+    rects[count++] = merged;
+    return;
+  }
+
+  // Немає місця - зливаємо з прямокутником, що найменше виросте
+  uint8_t best = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint8_t i = 0; i < count; i++) {
+    int32_t growth = merged.unite(rects[i]).area() - rects[i].area();
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      best = i;
+    }
+  }
+  Rect united = merged.unite(rects[best]);
+  removeAt(best);
+  add(united);
+}
+
+// ============= WIDGETS =============
+Widget::Widget(int16_t x, int16_t y, int16_t w, int16_t h) : dirty(true) {
+  bounds.x = x;
+  bounds.y = y;
+  bounds.w = w;
+  bounds.h = h;
+}
+
+void Widget::addDirtyRects(DirtyRegion& region) {
+  if (dirty) {
+    region.add(bounds);
+  }
+}
+
+LabelWidget::LabelWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+                         const char* label, uint16_t textColor, uint8_t size)
+  : Widget(x, y, w, h), text(label), color(textColor), textSize(size) {
+}
+
+void LabelWidget::setColor(uint16_t textColor) {
+  if (color != textColor) {
+    color = textColor;
+    dirty = true;
+  }
+}
+
+void LabelWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  gfx->setTextSize(textSize);
+  gfx->setTextColor(color);
+  gfx->setCursor(bounds.x + ox, bounds.y + oy);
+  gfx->print(text);
+}
+
+ValueWidget::ValueWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+                         uint16_t textColor, uint8_t size)
+  : Widget(x, y, w, h), color(textColor), textSize(size) {
+  text[0] = '\0';
+}
+
+void ValueWidget::setText(const char* value) {
+  if (strncmp(text, value, sizeof(text)) != 0) {
+    strlcpy(text, value, sizeof(text));
+    dirty = true;
+  }
+}
+
+void ValueWidget::setFormatted(const char* format, ...) {
+  char buffer[WIDGET_TEXT_MAX];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  setText(buffer);
+}
+
+void ValueWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  gfx->setTextSize(textSize);
+  gfx->setTextColor(color);
+  gfx->setCursor(bounds.x + ox, bounds.y + oy);
+  gfx->print(text);
+}
+
+BarWidget::BarWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+                     int16_t maximum, uint16_t barColor)
+  : Widget(x, y, w, h), value(0), maxValue(maximum), color(barColor) {
+}
+
+void BarWidget::setValue(int16_t newValue) {
+  if (newValue < 0) newValue = 0;
+  if (newValue > maxValue) newValue = maxValue;
+  if (value != newValue) {
+    value = newValue;
+    dirty = true;
+  }
+}
+
+void BarWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  int16_t fill = (int32_t)(bounds.w - 2) * value / maxValue;
+  gfx->drawRect(bounds.x + ox, bounds.y + oy, bounds.w, bounds.h, color);
+  gfx->fillRect(bounds.x + ox + 1, bounds.y + oy + 1, fill, bounds.h - 2, color);
+}
+
+// 6x8 - комірка стандартного шрифту при textSize 1
+ClockWidget::ClockWidget(int16_t x, int16_t y, uint16_t textColor, uint8_t size)
+  : Widget(x, y, 6 * size * CLOCK_CHARS, 8 * size),
+    cellWidth(6 * size), color(textColor), textSize(size) {
+  text[0] = '\0';
+  drawn[0] = '\0';
+}
+
+void ClockWidget::begin() {
+  static const char GLYPH_CHARS[CLOCK_GLYPHS + 1] = "0123456789:";
+
+  for (int i = 0; i < CLOCK_GLYPHS; i++) {
+    // 1 біт на піксель: 150 байт на гліф, буфер спрайта - готовий бітмап
+    glyphs[i].setColorDepth(1);
+    glyphs[i].createSprite(cellWidth, bounds.h);
+    glyphs[i].createPalette();
+    glyphs[i].fillSprite(0);
+    glyphs[i].setTextSize(textSize);
+    glyphs[i].setTextColor(1);
+    glyphs[i].setCursor(0, 0);
+    glyphs[i].print(GLYPH_CHARS[i]);
+  }
+}
+
+int ClockWidget::glyphIndex(char c) const {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c == ':') return 10;
+  return -1;
+}
+
+Rect ClockWidget::cellRect(uint8_t index) const {
+  Rect cell = {(int16_t)(bounds.x + index * cellWidth), bounds.y, cellWidth, bounds.h};
+  return cell;
+}
+
+void ClockWidget::setTime(const char* value) {
+  strlcpy(text, value, sizeof(text));
+}
+
+void ClockWidget::addDirtyRects(DirtyRegion& region) {
+  size_t length = strlen(text);
+  if (dirty || length != strlen(drawn)) {
+    region.add(bounds);
+    return;
+  }
+
+  // Зазвичай змінюється лише остання цифра секунд
+  for (uint8_t i = 0; i < length; i++) {
+    if (text[i] != drawn[i]) {
+      region.add(cellRect(i));
+    }
+  }
+}
+
+void ClockWidget::clearDirty() {
+  dirty = false;
+  memcpy(drawn, text, sizeof(drawn));
+}
+
+void ClockWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  // Кліп цілі відсікає клітинки поза поточною смугою
+  for (uint8_t i = 0; i < CLOCK_CHARS && text[i] != '\0'; i++) {
+    int glyph = glyphIndex(text[i]);
+    if (glyph < 0) continue;
+
+    // Бітмап малюється кольором віджета, тож працює і в палітровому буфері
+    Rect cell = cellRect(i);
+    gfx->drawBitmap(cell.x + ox, cell.y + oy, (const uint8_t*)glyphs[glyph].getBuffer(),
+                    cellWidth, bounds.h, color);
+  }
+}
+
+// Дві колонки за вибірку - нова і порожня за нею
+static_assert(2 * GRAPH_HEIGHT * 2 <= GRAPH_SPI_BUDGET, "нова колонка графіка не вміщається в бюджет SPI");
+
+GraphWidget::GraphWidget(int16_t x, int16_t y, int16_t h, uint16_t line, uint16_t fill)
+  : Widget(x, y, GRAPH_COLUMNS, h), head(GRAPH_COLUMNS - 1), pending(0),
+    low(0), high(0), lineColor(line), fillColor(fill) {
+  memset(values, 0, sizeof(values));
+}
+
+bool GraphWidget::rescale() {
+  uint16_t minValue = UINT16_MAX;
+  uint16_t maxValue = 0;
+  for (uint16_t i = 0; i < GRAPH_COLUMNS; i++) {
+    if (values[i] == 0) continue;
+    if (values[i] < minValue) minValue = values[i];
+    if (values[i] > maxValue) maxValue = values[i];
+  }
+  if (maxValue == 0) return false;
+
+  uint16_t newLow = minValue / GRAPH_SCALE_STEP * GRAPH_SCALE_STEP;
+  uint16_t newHigh = (maxValue + GRAPH_SCALE_STEP - 1) / GRAPH_SCALE_STEP * GRAPH_SCALE_STEP;
+  if (newHigh - newLow < GRAPH_MIN_SPAN) {
+    // Рівний тиск не розтягується на всю висоту: шкала навколо середини
+    uint16_t steps = (GRAPH_MIN_SPAN - (newHigh - newLow)) / GRAPH_SCALE_STEP;
+    uint16_t below = steps / 2 * GRAPH_SCALE_STEP;
+    newLow = newLow > below ? newLow - below : 0;
+    newHigh = newLow + GRAPH_MIN_SPAN;
+  }
+
+  if (newLow == low && newHigh == high) return false;
+  low = newLow;
+  high = newHigh;
+  return true;
+}
+
+int16_t GraphWidget::valueToY(uint16_t value) const {
+  int16_t bottom = bounds.y + bounds.h - 1;
+  if (value <= low) return bottom;
+  if (value >= high) return bounds.y;
+  return bottom - (int32_t)(value - low) * (bounds.h - 1) / (high - low);
+}
+
+void GraphWidget::push(uint16_t value) {
+  head = (head + 1) % GRAPH_COLUMNS;
+  values[head] = value;
+  if (pending < GRAPH_COLUMNS) {
+    pending++;
+  }
+  if (rescale()) {
+    dirty = true;
+  }
+}
+
+uint16_t GraphWidget::getValue(uint16_t columnsAgo) const {
+  if (columnsAgo >= GRAPH_COLUMNS - 1) return 0;
+  return values[(head + GRAPH_COLUMNS - columnsAgo) % GRAPH_COLUMNS];
+}
+
+void GraphWidget::addColumns(DirtyRegion& region, uint16_t first, uint16_t count) const {
+  // Діапазон може перейти через правий край - тоді два прямокутники
+  uint16_t right = first + count > GRAPH_COLUMNS ? GRAPH_COLUMNS - first : count;
+  Rect part = {(int16_t)(bounds.x + first), bounds.y, (int16_t)right, bounds.h};
+  region.add(part);
+  if (right < count) {
+    Rect wrapped = {bounds.x, bounds.y, (int16_t)(count - right), bounds.h};
+    region.add(wrapped);
+  }
+}
+
+void GraphWidget::addDirtyRects(DirtyRegion& region) {
+  if (dirty || pending + 1 >= GRAPH_COLUMNS) {
+    region.add(bounds);
+    return;
+  }
+  if (pending == 0) return;
+
+  // Нові колонки і порожня за ними, де щойно була найстаріша
+  uint16_t first = (head + GRAPH_COLUMNS + 1 - pending) % GRAPH_COLUMNS;
+  addColumns(region, first, pending + 1);
+}
+
+void GraphWidget::clearDirty() {
+  dirty = false;
+  pending = 0;
+}
+
+void GraphWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  if (high == 0) return;
+
+  uint16_t gap = (head + 1) % GRAPH_COLUMNS;
+  int16_t bottom = bounds.y + bounds.h - 1;
+  for (uint16_t i = 0; i < GRAPH_COLUMNS; i++) {
+    if (i == gap || values[i] == 0) continue;
+
+    // Кліп цілі відкидає колонки поза брудним прямокутником
+    int16_t x = bounds.x + i + ox;
+    int16_t y = valueToY(values[i]);
+    if (y < bottom) {
+      gfx->drawFastVLine(x, y + 1 + oy, bottom - y, fillColor);
+    }
+    gfx->drawPixel(x, y + oy, lineColor);
+  }
+}
+
+TrendWidget::TrendWidget(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t arrowColor)
+  : Widget(x, y, w, h), trend(TREND_UNKNOWN), color(arrowColor) {
+}
+
+void TrendWidget::setTrend(Trend value) {
+  if (trend != value) {
+    trend = value;
+    dirty = true;
+  }
+}
+
+void TrendWidget::draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) {
+  int16_t left = bounds.x + ox;
+  int16_t top = bounds.y + oy;
+  int16_t cx = left + bounds.w / 2;
+  int16_t cy = top + bounds.h / 2;
+  int16_t head = bounds.w / 2;
+
+  // Древко в третину ширини, вістря - рівнобедрений трикутник
+  switch (trend) {
+    case TREND_RISING:
+      gfx->fillTriangle(cx, top, left, top + head, left + bounds.w - 1, top + head, color);
+      gfx->fillRect(cx - bounds.w / 6, top + head, bounds.w / 3, bounds.h - head, color);
+      break;
+
+    case TREND_FALLING:
+      gfx->fillTriangle(cx, top + bounds.h - 1, left, top + bounds.h - 1 - head,
+                        left + bounds.w - 1, top + bounds.h - 1 - head, color);
+      gfx->fillRect(cx - bounds.w / 6, top, bounds.w / 3, bounds.h - head, color);
+      break;
+
+    case TREND_STEADY:
+      gfx->fillTriangle(left + bounds.w - 1, cy, left + bounds.w - 1 - head, cy - head,
+                        left + bounds.w - 1 - head, cy + head, color);
+      gfx->fillRect(left, cy - bounds.w / 6, bounds.w - head, bounds.w / 3, color);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// ============= COMPOSITOR =============
+// Команди ST7789 для апаратної прокрутки
+#define ST7789_VSCRDEF 0x33
+#define ST7789_VSCSAD  0x37
+
+Compositor::Compositor(lgfx::LovyanGFX* target, LGFX_Sprite* front, LGFX_Sprite* back, uint16_t bg)
+  : panel(target), widgetCount(0), backIndex(1), background(bg),
+    basePalette(NULL), paletteSize(0), submitQueue(NULL), taskHandle(NULL),
+    lastFrameBytes(0), lastRenderMicros(0), lastTransferMicros(0),
+    totalBytes(0), framesSubmitted(0), framesCompleted(0) {
+  framebuffers[0] = front;
+  framebuffers[1] = back;
+  for (uint8_t i = 0; i < FRAME_BUFFERS; i++) {
+    bufferFree[i] = NULL;
+    appliedLevel[i] = FRAME_LEVEL_FULL;
+  }
+}
+
+void Compositor::begin(const uint32_t* palette, uint8_t count) {
+  if (taskHandle != NULL) return;
+
+  basePalette = palette;
+  paletteSize = count;
+
+  // Прокручується вся видима область, решта GRAM лишається поза нею
+  panel->startWrite();
+  panel->writeCommand(ST7789_VSCRDEF);
+  panel->writeData(0);
+  panel->writeData(0);
+  panel->writeData(SCREEN_WIDTH >> 8);
+  panel->writeData(SCREEN_WIDTH & 0xFF);
+  panel->writeData((PANEL_MEMORY_HEIGHT - SCREEN_WIDTH) >> 8);
+  panel->writeData((PANEL_MEMORY_HEIGHT - SCREEN_WIDTH) & 0xFF);
+  panel->endWrite();
+  writeScroll(0);
+
+  // Не більше одного кадру на буфер у черзі
+  submitQueue = xQueueCreate(FRAME_BUFFERS, sizeof(FrameSubmission));
+  for (uint8_t i = 0; i < FRAME_BUFFERS; i++) {
+    bufferFree[i] = xSemaphoreCreateBinary();
+    xSemaphoreGive(bufferFree[i]);
+  }
+  xTaskCreate(taskEntry, "display", DISPLAY_TASK_STACK, this, DISPLAY_TASK_PRIORITY, &taskHandle);
+}
+
+void Compositor::clearWidgets(uint8_t keep) {
+  // Місце, яке займали старі віджети, треба очистити
+  for (uint8_t i = keep; i < widgetCount; i++) {
+    dirty.add(widgets[i]->getBounds());
+  }
+  if (widgetCount > keep) {
+    widgetCount = keep;
+  }
+}
+
+void Compositor::add(Widget* widget) {
+  if (widgetCount >= COMPOSITOR_MAX_WIDGETS) return;
+
+  widgets[widgetCount++] = widget;
+  widget->markDirty();
+}
+
+void Compositor::invalidate(const Rect& rect) {
+  dirty.add(rect);
+}
+
+void Compositor::renderRect(LGFX_Sprite* target, const Rect& rect) {
+  // Буфер повноекранний: малюємо на місці, у координатах екрана
+  target->setClipRect(rect.x, rect.y, rect.w, rect.h);
+  target->fillRect(rect.x, rect.y, rect.w, rect.h, background);
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    if (widgets[i]->getBounds().intersects(rect)) {
+      widgets[i]->draw(target, 0, 0);
+    }
+  }
+  target->clearClipRect();
+}
+
+void Compositor::collectDirty() {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    widgets[i]->addDirtyRects(dirty);
+  }
+}
+
+void Compositor::renderBack(bool collected) {
+  // Задній буфер міг ще не повернутися з позаминулого кадру
+  xSemaphoreTake(bufferFree[backIndex], portMAX_DELAY);
+
+  uint32_t start = micros();
+  LGFX_Sprite* target = framebuffers[backIndex];
+
+  // Спершу наздоганяємо зміни, які пройшли повз цей буфер
+  DirtyRegion& catchUp = stale[backIndex];
+  for (uint8_t i = 0; i < catchUp.size(); i++) {
+    renderRect(target, catchUp[i]);
+  }
+  catchUp.clear();
+
+  for (uint8_t i = 0; i < dirty.size(); i++) {
+    renderRect(target, dirty[i]);
+  }
+
+  // Віджети, чиї зміни не збиралися, лишаються брудними до наступного кадру
+  if (collected) {
+    for (uint8_t i = 0; i < widgetCount; i++) {
+      widgets[i]->clearDirty();
+    }
+  }
+
+  // Інший буфер отримає ці зміни, коли до нього дійде черга
+  uint8_t frontIndex = backIndex ^ 1;
+  for (uint8_t i = 0; i < dirty.size(); i++) {
+    stale[frontIndex].add(dirty[i]);
+  }
+
+  lastRenderMicros = micros() - start;
+}
+
+void Compositor::enqueue(const DirtyRegion& push, int16_t scroll, uint8_t level) {
+  FrameSubmission frame;
+  frame.buffer = backIndex;
+  frame.rectCount = push.size();
+  frame.level = level;
+  frame.scroll = scroll;
+  lastFrameBytes = 0;
+  for (uint8_t i = 0; i < push.size(); i++) {
+    frame.rects[i] = push[i];
+    lastFrameBytes += (uint32_t)push[i].area() * 2;
+  }
+  totalBytes += lastFrameBytes;
+  framesSubmitted++;
+
+  xQueueSend(submitQueue, &frame, portMAX_DELAY);
+  backIndex ^= 1;
+}
+
+bool Compositor::submit() {
+  collectDirty();
+
+  lastFrameBytes = 0;
+  lastRenderMicros = 0;
+  if (dirty.size() == 0 || taskHandle == NULL) return false;
+
+  // На панель досить відправити лише нові зміни
+  renderBack(true);
+  enqueue(dirty, FRAME_SCROLL_KEEP, FRAME_LEVEL_FULL);
+  dirty.clear();
+  return true;
+}
+
+bool Compositor::submitEffect(const DirtyRegion& push, int16_t scroll, uint8_t level) {
+  if (taskHandle == NULL) return false;
+
+  // Повне перемалювання (початок анімації) забирає і стан віджетів,
+  // інакше лише наздоганяємо задній буфер
+  bool collected = dirty.size() > 0;
+  if (collected) {
+    collectDirty();
+  }
+  renderBack(collected);
+  enqueue(push, scroll, level);
+  dirty.clear();
+  return true;
+}
+
+void Compositor::collectWidgetBounds(DirtyRegion& region) const {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    region.add(widgets[i]->getBounds());
+  }
+}
+
+bool Compositor::isFrameComplete() const {
+  return framesCompleted == framesSubmitted;
+}
+
+bool Compositor::waitFrameComplete(TickType_t timeout) {
+  TickType_t start = xTaskGetTickCount();
+  while (!isFrameComplete()) {
+    if (xTaskGetTickCount() - start >= timeout) return false;
+    vTaskDelay(1);
+  }
+  return true;
+}
+
+void Compositor::taskEntry(void* arg) {
+  static_cast<Compositor*>(arg)->taskLoop();
+}
+
+void Compositor::taskLoop() {
+  FrameSubmission frame;
+
+  for (;;) {
+    xQueueReceive(submitQueue, &frame, portMAX_DELAY);
+
+    uint32_t start = micros();
+    transfer(frame);
+    lastTransferMicros = micros() - start;
+
+    framesCompleted++;
+    xSemaphoreGive(bufferFree[frame.buffer]);
+  }
+}
+
+void Compositor::transfer(const FrameSubmission& frame) {
+  LGFX_Sprite* source = framebuffers[frame.buffer];
+
+  // Палітру буфера можна міняти лише тут: поки кадр у черзі,
+  // буфер належить цій задачі
+  if (appliedLevel[frame.buffer] != frame.level) {
+    applyPalette(source, frame.level);
+    appliedLevel[frame.buffer] = frame.level;
+  }
+
+  // Уся передача - в цій задачі: loop() тим часом малює наступний кадр
+  panel->startWrite();
+  if (frame.scroll != FRAME_SCROLL_KEEP) {
+    writeScroll(frame.scroll);
+  }
+  for (uint8_t i = 0; i < frame.rectCount; i++) {
+    const Rect& rect = frame.rects[i];
+    // Кліп на панелі обрізає передачу до брудного прямокутника,
+    // палітра розгортається в RGB565 під час відправки
+    panel->setClipRect(rect.x, rect.y, rect.w, rect.h);
+    source->pushSprite(0, 0);
+  }
+  panel->clearClipRect();
+  panel->endWrite();
+}
+
+void Compositor::applyPalette(LGFX_Sprite* buffer, uint8_t level) {
+  if (basePalette == NULL) return;
+
+  // Тло чорне, тож згасання палітри не потребує перемалювання пікселів
+  for (uint8_t i = 0; i < paletteSize; i++) {
+    uint32_t rgb = basePalette[i];
+    buffer->setPaletteColor(i,
+                            (uint8_t)(((rgb >> 16) & 0xFF) * level / FRAME_LEVEL_FULL),
+                            (uint8_t)(((rgb >> 8) & 0xFF) * level / FRAME_LEVEL_FULL),
+                            (uint8_t)((rgb & 0xFF) * level / FRAME_LEVEL_FULL));
+  }
+}
+
+void Compositor::writeScroll(int16_t offset) {
+  // При rotation 1 рядки GRAM ідуть уздовж x, тож прокрутка горизонтальна
+  uint16_t line = (uint16_t)(offset % SCREEN_WIDTH);
+#if PANEL_SCROLL_MIRRORED
+  line = (SCREEN_WIDTH - line) % SCREEN_WIDTH;
+#endif
+
+  panel->startWrite();
+  panel->writeCommand(ST7789_VSCSAD);
+  panel->writeData(line >> 8);
+  panel->writeData(line & 0xFF);
+  panel->endWrite();
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "config.h"
+
+#define DIRTY_RECT_MAX        8
+#define COMPOSITOR_MAX_WIDGETS 16
+#define WIDGET_TEXT_MAX       32
+#define CLOCK_CHARS           8   // "HH:MM:SS"
+#define CLOCK_GLYPHS          11  // 0-9 і ':'
+
+// ============= ПРЯМОКУТНИКИ =============
+struct Rect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  bool isEmpty() const { return w <= 0 || h <= 0; }
+  int32_t area() const { return (int32_t)w * h; }
+  bool intersects(const Rect& other) const;
+  Rect unite(const Rect& other) const;
+};
+
+// Набір брудних прямокутників; близькі зливаються,
+// щоб кількість SPI-вікон на кадр лишалась малою
+class DirtyRegion {
+private:
+  Rect rects[DIRTY_RECT_MAX];
+  uint8_t count;
+
+  void removeAt(uint8_t index);
+
+public:
+  DirtyRegion() : count(0) {}
+
+  void add(const Rect& rect);
+  void clear() { count = 0; }
+  uint8_t size() const { return count; }
+  const Rect& operator[](uint8_t index) const { return rects[index]; }
+};
+
+// ============= ВІДЖЕТИ =============
+class Widget {
+protected:
+  Rect bounds;
+  bool dirty;
+
+public:
+  Widget(int16_t x, int16_t y, int16_t w, int16_t h);
+  virtual ~Widget() {}
+
+  const Rect& getBounds() const { return bounds; }
+  bool isDirty() const { return dirty; }
+  void markDirty() { dirty = true; }
+
+  // Додає до регіону області, які треба перемалювати
+  virtual void addDirtyRects(DirtyRegion& region);
+  virtual void clearDirty() { dirty = false; }
+
+  // (ox, oy) - зсув цілі відносно екрана
+  virtual void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) = 0;
+};
+
+class LabelWidget : public Widget {
+private:
+  const char* text;
+  uint16_t color;
+  uint8_t textSize;
+
+public:
+  LabelWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+              const char* label, uint16_t textColor, uint8_t size);
+
+  void setColor(uint16_t textColor);
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+class ValueWidget : public Widget {
+private:
+  char text[WIDGET_TEXT_MAX];
+  uint16_t color;
+  uint8_t textSize;
+
+public:
+  ValueWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+              uint16_t textColor, uint8_t size);
+
+  // Позначає віджет брудним лише якщо текст змінився
+  void setText(const char* value);
+  void setFormatted(const char* format, ...);
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+class BarWidget : public Widget {
+private:
+  int16_t value;
+  int16_t maxValue;
+  uint16_t color;
+
+public:
+  BarWidget(int16_t x, int16_t y, int16_t w, int16_t h,
+            int16_t maximum, uint16_t barColor);
+
+  void setValue(int16_t newValue);
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+// Великий годинник: цифри і двокрапка растеризуються один раз у
+// 1-бітні бітмапи, а за тік брудними стають лише змінені клітинки
+class ClockWidget : public Widget {
+private:
+  LGFX_Sprite glyphs[CLOCK_GLYPHS];
+  char text[CLOCK_CHARS + 1];
+  char drawn[CLOCK_CHARS + 1];
+  int16_t cellWidth;
+  uint16_t color;
+  uint8_t textSize;
+
+  int glyphIndex(char c) const;
+  Rect cellRect(uint8_t index) const;
+
+public:
+  ClockWidget(int16_t x, int16_t y, uint16_t textColor, uint8_t size);
+
+  void begin();
+  void setTime(const char* value);
+  void addDirtyRects(DirtyRegion& region) override;
+  void clearDirty() override;
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+// Графік по колонці на інтервал, що заповнюється по колу, як на
+// моніторі: за новою колонкою завжди порожня, вона й показує "зараз".
+// З новою вибіркою брудні лише ці дві колонки, уся площа - лише коли
+// змінюються межі шкали, кратні GRAPH_SCALE_STEP.
+class GraphWidget : public Widget {
+private:
+  uint16_t values[GRAPH_COLUMNS];  // 0 - немає даних за інтервал
+  uint16_t head;                   // остання записана колонка
+  uint16_t pending;                // колонок, записаних після останнього кадру
+  uint16_t low;
+  uint16_t high;
+  uint16_t lineColor;
+  uint16_t fillColor;
+
+  bool rescale();
+  int16_t valueToY(uint16_t value) const;
+  void addColumns(DirtyRegion& region, uint16_t first, uint16_t count) const;
+
+public:
+  GraphWidget(int16_t x, int16_t y, int16_t h, uint16_t line, uint16_t fill);
+
+  void push(uint16_t value);
+  // Значення columnsAgo колонок тому; 0 - немає
+  uint16_t getValue(uint16_t columnsAgo) const;
+  void addDirtyRects(DirtyRegion& region) override;
+  void clearDirty() override;
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+enum Trend : int8_t {
+  TREND_FALLING = -1,
+  TREND_STEADY = 0,
+  TREND_RISING = 1,
+  TREND_UNKNOWN = 2
+};
+
+// Стрілка тенденції: вгору, вниз або вправо
+class TrendWidget : public Widget {
+private:
+  Trend trend;
+  uint16_t color;
+
+public:
+  TrendWidget(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t arrowColor);
+
+  void setTrend(Trend value);
+  void draw(lgfx::LovyanGFX* gfx, int16_t ox, int16_t oy) override;
+};
+
+// ============= КОМПОЗИТОР =============
+#define FRAME_BUFFERS 2
+#define FRAME_LEVEL_FULL 255
+#define FRAME_SCROLL_KEEP -1
+
+// Кадр, переданий задачі відправки: буфер і вікна, які треба вивести
+struct FrameSubmission {
+  uint8_t buffer;
+  uint8_t rectCount;
+  uint8_t level;      // яскравість палітри, 255 - без згасання
+  int16_t scroll;     // зсув апаратної прокрутки або FRAME_SCROLL_KEEP
+  Rect rects[DIRTY_RECT_MAX];
+};
+
+// Перемальовує лише брудні області в одному з двох повноекранних
+// кадрових буферів. Поки задача відправки передає на панель кадр N,
+// loop() уже малює кадр N+1 в іншому буфері.
+class Compositor {
+private:
+  lgfx::LovyanGFX* panel;
+  LGFX_Sprite* framebuffers[FRAME_BUFFERS];
+  Widget* widgets[COMPOSITOR_MAX_WIDGETS];
+  uint8_t widgetCount;
+  DirtyRegion dirty;
+  // Що змінилося, поки буфер був на відправці: ці області
+  // в ньому застаріли і перемальовуються разом з наступним кадром
+  DirtyRegion stale[FRAME_BUFFERS];
+  uint8_t backIndex;
+  uint16_t background;
+
+  const uint32_t* basePalette;
+  uint8_t paletteSize;
+  // Яскравість, під яку зараз налаштована палітра кожного буфера
+  uint8_t appliedLevel[FRAME_BUFFERS];
+
+  QueueHandle_t submitQueue;
+  // Вільний семафор - буфер не передається і в нього можна малювати
+  SemaphoreHandle_t bufferFree[FRAME_BUFFERS];
+  TaskHandle_t taskHandle;
+
+  uint32_t lastFrameBytes;
+  uint32_t lastRenderMicros;
+  volatile uint32_t lastTransferMicros;
+  uint32_t totalBytes;
+  uint32_t framesSubmitted;
+  volatile uint32_t framesCompleted;
+
+  void renderRect(LGFX_Sprite* target, const Rect& rect);
+  void collectDirty();
+  void renderBack(bool collected);
+  void enqueue(const DirtyRegion& push, int16_t scroll, uint8_t level);
+  static void taskEntry(void* arg);
+  void taskLoop();
+  void transfer(const FrameSubmission& frame);
+  void applyPalette(LGFX_Sprite* buffer, uint8_t level);
+  void writeScroll(int16_t offset);
+
+public:
+  Compositor(lgfx::LovyanGFX* target, LGFX_Sprite* front, LGFX_Sprite* back, uint16_t bg);
+
+  // Створює задачу відправки; до цього буфери можна виводити вручну.
+  // palette - базові кольори RGB888 для згасання, за індексами буфера
+  void begin(const uint32_t* palette, uint8_t count);
+
+  // keep - скільки перших віджетів (заголовок) лишити на екрані
+  void clearWidgets(uint8_t keep = 0);
+  void add(Widget* widget);
+  void invalidate(const Rect& rect);
+
+  // Малює брудні області в задній буфер і ставить його на відправку.
+  // Чекає лише якщо цей буфер ще передається з позаминулого кадру.
+  // false - змін не було, кадр не відправлявся.
+  bool submit();
+  // Кадр анімації: як submit(), але на панель іде лише push,
+  // з новим зсувом прокрутки і яскравістю палітри. Зміни віджетів
+  // підхоплюються лише разом з invalidate(), решта чекає кінця анімації.
+  bool submitEffect(const DirtyRegion& push, int16_t scroll, uint8_t level);
+  // Межі всіх віджетів на екрані - область, яку зачіпає згасання
+  void collectWidgetBounds(DirtyRegion& region) const;
+  // true, коли всі відправлені кадри вже на панелі
+  bool isFrameComplete() const;
+  bool waitFrameComplete(TickType_t timeout);
+
+  uint32_t getLastFrameBytes() const { return lastFrameBytes; }
+  uint32_t getLastRenderMicros() const { return lastRenderMicros; }
+  uint32_t getLastTransferMicros() const { return lastTransferMicros; }
+  uint32_t getTotalBytes() const { return totalBytes; }
+  uint32_t getFramesSubmitted() const { return framesSubmitted; }
+  uint32_t getFramesCompleted() const { return framesCompleted; }
+};
+
+#endif // WIDGETS_H
\ No newline at end of file
@@ -1,37 +1,233 @@
 #include "wifi_manager.h"
 
 WiFiManager::WiFiManager(Storage* stor, AlarmManager* alarm, WeatherManager* weather,
-                         Screen* screen, bool* needUpdate)
+                         RingtoneStore* ringtones, DisplayManager* display, HistoryStore* log,
+                         Scheduler* sched, UiQueue* uiQueue, NetQueue* netQueue)
   : server(WEB_SERVER_PORT), storage(stor), alarmManager(alarm), 
-    weatherManager(weather), currentScreen(screen), needUpdateSetScreen(needUpdate) {
+    weatherManager(weather), ringtoneStore(ringtones), displayManager(display),
+    history(log), scheduler(sched), toUi(uiQueue), fromUi(netQueue), taskHandle(NULL),
+    link(stor), ringtoneUploadOk(false), ringtoneUploader(-1), assetRequests(0), assetNotModified(0),
+    assetBytes(0), assetSourceBytes(0), lastAssetMicros(0), maxAssetMicros(0), events(&server),
+    lastEventCheck(0), weatherWaiter(HTTP_TOKEN_NONE), weatherWaiterJobs(0),
+    shownScreen(SCREEN_TIME), sensorPressure(NAN), sensorTemperature(NAN),
+    hasWeatherKey(false) {
+  weatherKeyPrefix[0] = '\0';
+  memset(&lastEvent, 0, sizeof(lastEvent));
 }
 
 void WiFiManager::begin() {
-  server.on("/", [this]() { handleRoot(); });
-  server.on("/connect", [this]() { handleConnect(); });
-  server.on("/status", [this]() { handleStatus(); });
-  server.on("/alarm", [this]() { handleAlarm(); });
-  server.on("/weather/update", [this]() { handleWeatherUpdate(); });
-  server.on("/weather/apikey", [this]() { handleWeatherApiKey(); });
-  server.onNotFound([this]() { handleNotFound(); });
+  // Задачі ще не запущені, тож ключ можна прочитати напряму
+  rememberWeatherKey(weatherManager->getApiKey().c_str());
+
+  // Сторінка, CSS і JS - стиснуті наперед у web_assets.h
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset* asset = &WEB_ASSETS[i];
+    server.on(asset->path, HTTP_METHOD_GET, [this, asset](HttpRequest& req) { handleAsset(req, *asset); });
+  }
+  server.on("/events", HTTP_METHOD_GET, [this](HttpRequest& req) { events.accept(req); });
+  server.on("/connect", HTTP_METHOD_POST, [this](HttpRequest& req) { handleConnect(req); });
+  server.on("/status", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleStatus(req); });
+  server.on("/alarm", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleAlarm(req); });
+  server.on("/weather", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleWeather(req); });
+  server.on("/weather/update", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleWeatherUpdate(req); });
+  server.on("/weather/apikey", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleWeatherApiKey(req); });
+  server.on("/ringtone", HTTP_METHOD_POST, [this](HttpRequest& req) { handleRingtoneUploadDone(req); },
+            [this](HttpRequest& req, HttpBodyEvent event, const uint8_t* data, size_t length) {
+              handleRingtoneUpload(req, event, data, length);
+            });
+  server.on("/ringtone", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleRingtone(req); });
+  server.on("/ringtone/play", HTTP_METHOD_ANY, [this](HttpRequest& req) { handleRingtonePlay(req); });
+  server.on("/history", HTTP_METHOD_GET, [this](HttpRequest& req) { handleHistory(req); });
+  server.onNotFound([this](HttpRequest& req) { handleNotFound(req); });
   server.begin();
 }
 
+void WiFiManager::startTask() {
+  if (taskHandle != NULL) return;
+
+  xTaskCreate(taskEntry, "net", NET_TASK_STACK, this, NET_TASK_PRIORITY, &taskHandle);
+}
+
+void WiFiManager::taskEntry(void* arg) {
+  static_cast<WiFiManager*>(arg)->taskLoop();
+}
+
+void WiFiManager::taskLoop() {
+  // Затримки немає: задача спить у select() до активності сокетів
+  for (;;) {
+    handleClient();
+  }
+}
+
 void WiFiManager::handleClient() {
-  server.handleClient();
+  drainMessages();
+
+  // Після обриву погода, що не завантажилась офлайн, оновлюється одразу
+  if (link.service()) {
+    UiMessage msg = {};
+    msg.type = UI_MSG_WEATHER_REFRESH;
+    sendToUi(msg);
+  }
+
+  server.service(WEB_POLL_INTERVAL);
+  serviceDeferred();
+  serviceEvents();
 }
 
-bool WiFiManager::connectToWiFi(const String& ssid, const String& password) {
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid.c_str(), password.c_str());
-  
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    attempts++;
+void WiFiManager::drainMessages() {
+  NetMessage msg;
+  while (fromUi->pop(msg)) {
+    switch (msg.type) {
+      case NET_MSG_SCREEN:
+        shownScreen = (Screen)msg.screen;
+        break;
+
+      case NET_MSG_SENSOR:
+        sensorPressure = msg.pressurePa;
+        sensorTemperature = msg.temperature;
+        break;
+    }
   }
-  
-  return (WiFi.status() == WL_CONNECTED);
+}
+
+bool WiFiManager::sendToUi(const UiMessage& msg) {
+  if (!toUi->push(msg)) {
+    return false;
+  }
+  scheduler->post(SCHED_EVENT_MESSAGE);
+  return true;
+}
+
+void WiFiManager::serviceDeferred() {
+  if (weatherWaiter == HTTP_TOKEN_NONE) return;
+
+  // null - клієнт пішов або сервер уже відповів 504
+  HttpRequest* req = server.resume(weatherWaiter);
+  if (req != NULL && weatherManager->getJobsFinished() == weatherWaiterJobs) return;
+
+  weatherWaiter = HTTP_TOKEN_NONE;
+  if (req != NULL) {
+    handleWeather(*req);
+  }
+}
+
+void WiFiManager::serviceEvents() {
+  uint32_t now = millis();
+  if (now - lastEventCheck < EVENTS_COALESCE_MS) return;
+  lastEventCheck = now;
+  if (!events.hasClients()) return;
+
+  EventState state;
+  captureEventState(state);
+  char buffer[EVENTS_BUFFER_SIZE];
+
+  // Усе, що змінилось за вікно, - однією подією
+  uint8_t changed = diffEventState(state, lastEvent);
+  if (changed != 0) {
+    size_t length = writeEvent(state, changed, buffer, sizeof(buffer));
+    events.broadcast(buffer, length);
+  }
+  if (events.hasFreshClients()) {
+    size_t length = writeEvent(state, EVENT_GROUP_ALL, buffer, sizeof(buffer));
+    events.sendToFresh(buffer, length);
+  }
+
+  lastEvent = state;
+  events.heartbeat(now);
+}
+
+void WiFiManager::captureEventState(EventState& state) {
+  memset(&state, 0, sizeof(state));
+  state.screen = shownScreen;
+  state.alarmHour = alarmManager->getHour();
+  state.alarmMinute = alarmManager->getMinute();
+  state.alarmEnabled = alarmManager->isEnabled();
+  state.alarmTriggered = alarmManager->isTriggered();
+  state.alarmRinging = alarmManager->isRinging();
+  WeatherData weather;
+  weatherManager->getSnapshot(weather);
+  state.weatherStamp = weather.lastUpdate;
+  state.pressureDeciHpa = isnan(sensorPressure) ? INT32_MIN : lroundf(sensorPressure / 10.0f);
+  state.temperatureDeci = isnan(sensorTemperature) ? INT16_MIN : lroundf(sensorTemperature * 10.0f);
+  state.linkState = link.getState();
+  state.rssiBucket = link.isConnected() ? WiFi.RSSI() / EVENTS_RSSI_STEP : 0;
+}
+
+size_t WiFiManager::writeEvent(const EventState& state, uint8_t groups, char* buffer, size_t size) {
+  StaticJsonDocument<EVENTS_BUFFER_SIZE> doc;
+  // Копія погоди живе до serializeJson(): документ тримає вказівник на опис
+  WeatherData data;
+
+  if (groups & EVENT_GROUP_SCREEN) {
+    doc["screen"] = state.screen;
+  }
+  if (groups & EVENT_GROUP_ALARM) {
+    JsonObject alarm = doc.createNestedObject("alarm");
+    alarm["hour"] = state.alarmHour;
+    alarm["minute"] = state.alarmMinute;
+    alarm["enabled"] = state.alarmEnabled;
+    alarm["triggered"] = state.alarmTriggered;
+    alarm["ringing"] = state.alarmRinging;
+  }
+  if (groups & EVENT_GROUP_WEATHER) {
+    weatherManager->getSnapshot(data);
+    JsonObject weather = doc.createNestedObject("weather");
+    weather["hasData"] = data.hasData;
+    weather["description"] = (const char*)data.description;
+    weather["temperature"] = data.temperature;
+    weather["humidity"] = data.humidity;
+    weather["pressure"] = data.pressure;
+  }
+  if (groups & EVENT_GROUP_SENSOR) {
+    JsonObject sensor = doc.createNestedObject("sensor");
+    if (state.pressureDeciHpa != INT32_MIN) {
+      sensor["pressure"] = state.pressureDeciHpa / 10.0f;
+    }
+    if (state.temperatureDeci != INT16_MIN) {
+      sensor["temperature"] = state.temperatureDeci / 10.0f;
+    }
+  }
+  if (groups & EVENT_GROUP_WIFI) {
+    JsonObject wifi = doc.createNestedObject("wifi");
+    wifi["state"] = link.getStateName();
+    wifi["rssi"] = state.rssiBucket * EVENTS_RSSI_STEP;
+  }
+
+  // "data: <json>\n\n" - одна подія SSE без проміжного String
+  size_t length = strlcpy(buffer, "data: ", size);
+  length += serializeJson(doc, buffer + length, size - length - 2);
+  buffer[length++] = '\n';
+  buffer[length++] = '\n';
+  return length;
+}
+
+void WiFiManager::rememberWeatherKey(const char* key) {
+  hasWeatherKey = key[0] != '\0';
+  strlcpy(weatherKeyPrefix, key, sizeof(weatherKeyPrefix));
+}
+
+void WiFiManager::sendJson(HttpRequest& req, int code, const JsonDocument& doc) {
+  // Довжина відома наперед, тож JSON пишеться одразу в буфер
+  // з'єднання - без String і без другої копії в send()
+  size_t length = measureJson(doc);
+  char* body = server.reserve(req, code, "application/json", length);
+  if (body == NULL) return;
+
+  serializeJson(doc, body, length + 1);
+  server.commit(req);
+}
+
+bool WiFiManager::connectToWiFi() {
+  return link.begin(true);
+}
+
+bool WiFiManager::waitForConnection(uint32_t timeoutMs) {
+  uint32_t start = millis();
+  while (!link.isConnected() && millis() - start < timeoutMs) {
+    link.service();
+    delay(50);
+  }
+  return link.isConnected();
 }
 
 void WiFiManager::startAP() {
@@ -39,273 +235,78 @@ void WiFiManager::startAP() {
   WiFi.softAP(AP_SSID, AP_PASSWORD);
 }
 
-bool WiFiManager::isConnected() {
-  return (WiFi.status() == WL_CONNECTED);
-}
-
-void WiFiManager::handleRoot() {
-  const char html_template[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta charset='utf-8'>
-  <meta name='viewport' content='width=device-width,initial-scale=1'>
-  <title>ESP Terminal Control</title>
-  <style>
-    * {margin:0;padding:0;box-sizing:border-box}
-    body {
-      font-family:'Courier New',monospace;
-      background:#0a0e14;
-      color:#00ff41;
-      min-height:100vh;
-      padding:20px;
-    }
-    .container {
-      max-width:800px;
-      margin:0 auto;
-      background:#1a1f2e;
-      border:2px solid #00ff41;
-      border-radius:5px;
-      padding:20px;
-      box-shadow:0 0 20px rgba(0,255,65,.3);
-    }
-    h1 {
-      text-align:center;
-      margin-bottom:20px;
-      text-shadow:0 0 10px #00ff41;
-    }
-    .section {
-      margin:20px 0;
-      padding:15px;
-      border:1px solid #00ff41;
-      border-radius:3px;
-    }
-    .section h2 {margin-bottom:10px;color:#00ccff}
-    button {
-      background:#00ff41;
-      color:#0a0e14;
-      border:none;
-      padding:10px 20px;
-      margin:5px;
-      cursor:pointer;
-      font-family:'Courier New',monospace;
-      font-weight:bold;
-      border-radius:3px;
-    }
-    button:hover {background:#00ccff}
-    input {
-      background:#0a0e14;
-      border:1px solid #00ff41;
-      color:#00ff41;
-      padding:8px;
-      margin:5px;
-      font-family:'Courier New',monospace;
-    }
-    #apiKey {
-      width: calc(100% - 10px);
-    }
-    .status {
-      padding:10px;
-      margin:10px 0;
-      background:#0a0e14;
-      border-left:3px solid #00ff41;
-    }
-    .info {color:#00ccff}
-    .warning {color:#ffaa00}
-    .error {color:#ff4444}
-  </style>
-</head>
-<body>
-  <div class='container'>
-    <h1>ESP Terminal</h1>
-    
-    <div class='section'>
-      <h2>📡 WiFi Configuration</h2>
-      <input type='text' id='ssid' placeholder='SSID'>
-      <input type='password' id='password' placeholder='Password'>
-      <button onclick='connectWiFi()'>Connect</button>
-      <div class='status' id='wifiStatus'></div>
-    </div>
-    
-    <div class='section'>
-      <h2>🔑 Weather API Key</h2>
-      <input type='text' id='apiKey' placeholder='OpenWeatherMap API Key'>
-      <button onclick='setApiKey()'>Save API Key</button>
-      <div class='status' id='apiKeyStatus'></div>
-    </div>
-    
-    <div class='section'>
-      <h2>📊 System Status</h2>
-      <div class='status' id='systemStatus'></div>
-    </div>
-    
-    <div class='section'>
-      <h2>⏰ Alarm Settings</h2>
-      <input type='number' id='alarmHour' min='0' max='23' placeholder='Hour' value='9'>
-      <input type='number' id='alarmMinute' min='0' max='59' placeholder='Minute' value='0'>
-      <button onclick='setAlarm()'>Set Alarm</button>
-      <button onclick='toggleAlarm()'>Toggle On/Off</button>
-      <div class='status' id='alarmStatus'></div>
-    </div>
-    
-    <div class='section'>
-      <h2>🌤️ Weather Data</h2>
-      <button onclick='updateWeather()'>Update Weather</button>
-      <div class='status' id='weatherStatus'></div>
-    </div>
-  </div>
-  
-  <script>
-    const api = (url, opts) => fetch(url, opts).then(r => opts?.json !== false ? r.json() : r.text());
-    
-    function connectWiFi() {
-      const ssid = document.getElementById('ssid').value;
-      const password = document.getElementById('password').value;
-      const params = new URLSearchParams({ssid, password});
-      
-      api('/connect', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/x-www-form-urlencoded'},
-        body: params,
-        json: false
-      })
-      .then(data => {
-        document.getElementById('wifiStatus').innerHTML = `<span class="info">✓ ${data}</span>`;
-      })
-      .catch(e => {
-        document.getElementById('wifiStatus').innerHTML = `<span class="error">✗ ${e}</span>`;
-      });
-    }
-    
-    function setApiKey() {
-      const apiKey = document.getElementById('apiKey').value;
-      
-      if (!apiKey) {
-        document.getElementById('apiKeyStatus').innerHTML = 
-          '<span class="error">✗ Please enter API key</span>';
-        return;
-      }
-      
-      api('/weather/apikey', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({apiKey})
-      })
-      .then(data => {
-        document.getElementById('apiKeyStatus').innerHTML = 
-          `<span class="info">✓ API Key saved: ${data.apiKey}</span>`;
-        document.getElementById('apiKey').value = '';
-      })
-      .catch(e => {
-        document.getElementById('apiKeyStatus').innerHTML = 
-          `<span class="error">✗ Failed: ${e}</span>`;
-      });
-    }
-    
-    function getStatus() {
-      api('/status')
-      .then(data => {
-        const html = [
-          `<span class="info">IP: ${data.ip}</span>`,
-          `Screen: ${data.screen}`,
-          `Uptime: ${(data.uptime / 1000).toFixed(0)}s`,
-          `Alarm: ${data.alarm.hour}:${data.alarm.minute} (${data.alarm.enabled ? 'ON' : 'OFF'})`
-        ].join('<br>');
-        document.getElementById('systemStatus').innerHTML = html;
-      });
-      
-      api('/weather/apikey')
-      .then(data => {
-        if (data.hasKey) {
-          document.getElementById('apiKeyStatus').innerHTML = 
-            `<span class="info">✓ API Key configured: ${data.apiKey}</span>`;
-        }
-      });
-    }
-    
-    function setAlarm() {
-      const hour = parseInt(document.getElementById('alarmHour').value);
-      const minute = parseInt(document.getElementById('alarmMinute').value);
-      
-      api('/alarm', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({hour, minute})
-      })
-      .then(data => {
-        document.getElementById('alarmStatus').innerHTML = 
-          `<span class="info">✓ Alarm set to ${data.hour}:${data.minute}</span>`;
-      });
-    }
-    
-    function toggleAlarm() {
-      api('/alarm', {
-        method: 'POST',
-        headers: {'Content-Type': 'application/json'},
-        body: JSON.stringify({toggle: true})
-      })
-      .then(data => {
-        document.getElementById('alarmStatus').innerHTML = 
-          `<span class="info">✓ Alarm ${data.enabled ? 'enabled' : 'disabled'}</span>`;
-      });
-    }
-    
-    function updateWeather() {
-      api('/weather/update')
-      .then(data => {
-        const html = [
-          '<span class="info">✓ Updated!</span>',
-          `Description: ${data.description}`,
-          `Temperature: ${data.temperature}°C`,
-          `Humidity: ${data.humidity}%`,
-          `Pressure: ${data.pressure} hPa`
-        ].join('<br>');
-        document.getElementById('weatherStatus').innerHTML = html;
-      })
-      .catch(e => {
-        document.getElementById('weatherStatus').innerHTML = 
-          `<span class="error">✗ Update failed: ${e}</span>`;
-      });
-    }
-    
-    setInterval(getStatus, 5000);
-    getStatus();
-  </script>
-</body>
-</html>
-)rawliteral";
-  
-  server.send_P(200, "text/html; charset=utf-8", html_template);
+void WiFiManager::handleAsset(HttpRequest& req, const WebAsset& asset) {
+  uint32_t start = micros();
+  assetRequests++;
+
+  server.addHeader(req, "ETag", asset.etag);
+  server.addHeader(req, "Cache-Control", asset.cacheControl);
+
+  // Браузер уже має цю версію - лише заголовки
+  if (strstr(req.ifNoneMatch, asset.etag) != NULL) {
+    assetNotModified++;
+    server.send(req, 304);
+  } else {
+    // Тіло йде просто з флешу, скільки прийме сокет за раз
+    server.addHeader(req, "Content-Encoding", "gzip");
+    server.sendStatic(req, 200, asset.contentType, asset.data, asset.length);
+    assetBytes += asset.length;
+    assetSourceBytes += asset.sourceLength;
+  }
+
+  lastAssetMicros = micros() - start;
+  if (lastAssetMicros > maxAssetMicros) {
+    maxAssetMicros = lastAssetMicros;
+  }
 }
 
-void WiFiManager::handleConnect() {
-  if (server.method() == HTTP_POST) {
-    String ssid = server.arg("ssid");
-    String password = server.arg("password");
+void WiFiManager::handleConnect(HttpRequest& req) {
+  if (req.method == HTTP_METHOD_POST) {
+    String ssid = req.arg("ssid");
+    String password = req.arg("password");
     
     if (ssid.length() > 0 && password.length() > 0) {
       storage->saveWiFiCredentials(ssid, password);
       
-      server.send(200, "text/plain; charset=utf-8", "Connecting to " + ssid + "...");
-      
-      delay(1000);
-      connectToWiFi(ssid, password);
-      
-      if (isConnected()) {
-        configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
-      }
+      server.send(req, 200, "text/plain; charset=utf-8", "Connecting to " + ssid + "...");
+
+      // Відповідь уже пішла; підключення йде у фоні, сервер не чекає.
+      // Нова мережа тепер перша в списку - шукаємо її скануванням.
+      link.begin(false);
     } else {
-      server.send(400, "text/plain; charset=utf-8", "Invalid credentials");
+      server.send(req, 400, "text/plain; charset=utf-8", "Invalid credentials");
     }
   }
 }
 
-void WiFiManager::handleStatus() {
-  StaticJsonDocument<512> doc;
-  
-  doc["ip"] = WiFi.localIP().toString();
+void WiFiManager::handleStatus(HttpRequest& req) {
+  StaticJsonDocument<3072> doc;
+
+  // Рядки - зі стека, документ лише посилається на них
+  char ip[16];
+  IPAddress localIp = WiFi.localIP();
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", localIp[0], localIp[1], localIp[2], localIp[3]);
+  wifi_ap_record_t apInfo;
+  bool hasApInfo = esp_wifi_sta_get_ap_info(&apInfo) == ESP_OK;
+
+  doc["ip"] = (const char*)ip;
   doc["connected"] = isConnected();
-  doc["screen"] = *currentScreen;
+
+  JsonObject wifi = doc.createNestedObject("wifi");
+  wifi["state"] = link.getStateName();
+  wifi["rssi"] = WiFi.RSSI();
+  wifi["attempts"] = link.getAttempts();
+  wifi["disconnects"] = link.getDisconnects();
+  wifi["lastReason"] = link.getLastReason();
+  wifi["reconnectMs"] = link.getLastReconnectMs();
+  wifi["maxReconnectMs"] = link.getMaxReconnectMs();
+  wifi["offlineMs"] = link.getOfflineMs();
+  wifi["ssid"] = hasApInfo ? (const char*)apInfo.ssid : "";
+  wifi["savedNetworks"] = link.getNetworkCount();
+  wifi["bootConnectMs"] = link.getBootConnectMs();
+  wifi["fastPath"] = link.wasLastConnectFast();
+  wifi["fastConnects"] = link.getFastConnects();
+  doc["screen"] = shownScreen;
   doc["uptime"] = millis();
   
   JsonObject alarm = doc.createNestedObject("alarm");
@@ -313,118 +314,442 @@ void WiFiManager::handleStatus() {
   alarm["minute"] = alarmManager->getMinute();
   alarm["enabled"] = alarmManager->isEnabled();
   alarm["triggered"] = alarmManager->isTriggered();
+  alarm["next"] = alarmManager->isEnabled() ? alarmManager->getNextFire() : 0;
+  alarm["underruns"] = alarmManager->getAudioUnderruns();
+
+  JsonObject display = doc.createNestedObject("display");
+  display["frameBytes"] = displayManager->getLastFrameBytes();
+  display["renderUs"] = displayManager->getLastRenderMicros();
+  display["transferUs"] = displayManager->getLastTransferMicros();
+  display["totalBytes"] = displayManager->getTotalBytes();
+  display["framesSubmitted"] = displayManager->getFramesSubmitted();
+  display["framesCompleted"] = displayManager->getFramesCompleted();
+  display["framebufferBytes"] = displayManager->getFramebufferBytes();
+  display["framebufferHeap"] = displayManager->getFramebufferHeapUsed();
+  display["legacySpriteBytes"] = LEGACY_SPRITE_BYTES;
+  display["transitions"] = displayManager->getTransitionCount();
+  display["droppedFrames"] = displayManager->getDroppedFrames();
+  display["inputLatencyUs"] = displayManager->getLastInputLatencyUs();
+  display["maxInputLatencyUs"] = displayManager->getMaxInputLatencyUs();
+  JsonArray histogram = display.createNestedArray("frameHistogram");
+  for (uint8_t i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+    histogram.add(displayManager->getFrameHistogram(i));
+  }
+
+  JsonObject web = doc.createNestedObject("web");
+  web["assetRequests"] = assetRequests;
+  web["notModified"] = assetNotModified;
+  web["bytesSent"] = assetBytes;
+  web["bytesUncompressed"] = assetSourceBytes;
+  web["handlerUs"] = lastAssetMicros;
+  web["maxHandlerUs"] = maxAssetMicros;
+  web["connections"] = server.getConnectionCount();
+  web["peakConnections"] = server.getPeakConnections();
+  web["requests"] = server.getRequests();
+  web["reused"] = server.getReused();
+  web["rejected"] = server.getRejected();
+  web["timeouts"] = server.getTimeouts();
+  web["responseUs"] = server.getLastResponseUs();
+  web["maxResponseUs"] = server.getMaxResponseUs();
+  web["maxRequestHandlerUs"] = server.getMaxHandlerUs();
+  JsonArray responseHistogram = web.createNestedArray("responseHistogram");
+  for (uint8_t i = 0; i < HTTP_HISTOGRAM_BUCKETS; i++) {
+    responseHistogram.add(server.getResponseHistogram(i));
+  }
+  web["eventClients"] = events.getClientCount();
+  web["eventsSent"] = events.getEventsSent();
+  web["eventBytes"] = events.getBytesSent();
+
+  // Лічильники лише ростуть, тож читання з іншої задачі безпечне
+  JsonObject nvs = doc.createNestedObject("storage");
+  nvs["nvsWrites"] = storage->getNvsWrites();
+  nvs["flushes"] = storage->getSettingsFlushes();
+  nvs["skipped"] = storage->getSkippedWrites();
+  nvs["dirty"] = storage->isDirty();
+  nvs["historyBlockWrites"] = history->getBlockWrites();
+  nvs["historyLatest"] = history->getLatestTime();
+
+  JsonObject sched = doc.createNestedObject("scheduler");
+  sched["idlePermille"] = scheduler->getIdlePermille();
+  JsonArray jobs = sched.createNestedArray("jobs");
+  for (uint8_t i = 0; i < scheduler->getJobCount(); i++) {
+    const SchedulerJob& job = scheduler->getJob(i);
+    JsonObject item = jobs.createNestedObject();
+    item["name"] = job.name;
+    item["runs"] = job.runs;
+    item["maxLatencyUs"] = job.maxLatencyUs;
+    item["maxRunUs"] = job.maxRunUs;
+  }
+  display["freeHeap"] = ESP.getFreeHeap();
   
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
-}
-
-void WiFiManager::handleAlarm() {
-  if (server.method() == HTTP_POST) {
-    String body = server.arg("plain");
-   
-    StaticJsonDocument<512> doc;
-    DeserializationError error = deserializeJson(doc, body);
-   
-    if (!error) {
-      if (doc.containsKey("hour") && doc.containsKey("minute")) {
-        alarmManager->setTime(doc["hour"], doc["minute"]);
+  sendJson(req, 200, doc);
+}
+
+// Один будильник у списку /alarm: id, hour, minute, days, enabled, skip, next
+#define ALARM_JSON_SIZE (JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(ALARM_SLOTS) + \
+                         ALARM_SLOTS * JSON_OBJECT_SIZE(7))
+
+// Ціле поле JSON у межах [low, high]; дріб, рядок чи null - ні
+static bool readJsonInt(const JsonDocument& doc, const char* key, long low, long high, long& out) {
+  if (!doc[key].is<long>()) return false;
+  out = doc[key].as<long>();
+  return out >= low && out <= high;
+}
+
+// id будильника з query: лише десяткове 1..255, без хвоста
+static bool parseAlarmId(const String& text, uint8_t& id) {
+  char* end;
+  unsigned long value = strtoul(text.c_str(), &end, 10);
+  if (text.length() == 0 || *end != '\0' || value == 0 || value > 255) return false;
+  id = (uint8_t)value;
+  return true;
+}
+
+void WiFiManager::handleAlarm(HttpRequest& req) {
+  // Знімок списку: змінює його лише задача UI, тут - тільки читання
+  AlarmRule rules[ALARM_SLOTS];
+  uint32_t fireAt[ALARM_SLOTS];
+  uint8_t count = alarmManager->getAlarms(rules, fireAt, ALARM_SLOTS);
+
+  int8_t found = -1;
+  UiMessage msg = {};
+
+  if (req.method == HTTP_METHOD_DELETE) {
+    uint8_t id;
+    if (!parseAlarmId(req.arg("id"), id)) {
+      server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid alarm id\"}");
+      return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+      if (rules[i].id == id) found = i;
+    }
+    if (found < 0) {
+      server.send(req, 404, "application/json", "{\"status\":\"error\",\"message\":\"No such alarm\"}");
+      return;
+    }
+    msg.type = UI_MSG_ALARM_DELETE;
+    msg.id = id;
+  } else if (req.method == HTTP_METHOD_POST) {
+    StaticJsonDocument<192> doc;
+    if (deserializeJson(doc, req.body)) {
+      server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+      return;
+    }
+
+    // Новий стан рахуємо тут, а застосовує і зберігає його задача UI
+    if (doc["snooze"] == true) {
+      msg.type = UI_MSG_ALARM_SNOOZE;
+    } else if (doc["stop"] == true) {
+      msg.type = UI_MSG_ALARM_STOP;
+    } else if (doc.containsKey("id")) {
+      long id;
+      if (!readJsonInt(doc, "id", 1, 255, id)) {
+        server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid alarm id\"}");
+        return;
       }
-      
+      for (uint8_t i = 0; i < count; i++) {
+        if (rules[i].id == id) found = i;
+      }
+      if (found < 0) {
+        server.send(req, 404, "application/json", "{\"status\":\"error\",\"message\":\"No such alarm\"}");
+        return;
+      }
+      msg.type = UI_MSG_ALARM_UPDATE;
+      msg.id = (uint8_t)id;
+      msg.enabled = (rules[found].flags & ALARM_ENABLED) != 0;
+      msg.skip = (rules[found].flags & ALARM_SKIP_NEXT) != 0;
       if (doc.containsKey("enabled")) {
-        alarmManager->setEnabled(doc["enabled"]);
+        msg.enabled = doc["enabled"];
       }
-      
       if (doc.containsKey("toggle")) {
-        alarmManager->toggleEnabled();
+        msg.enabled = !msg.enabled;
+      }
+      if (doc.containsKey("skip")) {
+        msg.skip = doc["skip"];
+      }
+    } else if (doc.containsKey("hour") && doc.containsKey("minute")) {
+      if (count >= ALARM_SLOTS) {
+        server.send(req, 409, "application/json", "{\"status\":\"error\",\"message\":\"Alarm list is full\"}");
+        return;
+      }
+      // Невірний час - помилка, а не найближчий допустимий будильник
+      long hour, minute;
+      long days = ALARM_EVERY_DAY;
+      if (!readJsonInt(doc, "hour", 0, 23, hour) || !readJsonInt(doc, "minute", 0, 59, minute)) {
+        server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"hour must be 0-23 and minute 0-59\"}");
+        return;
+      }
+      // Без днів - щодня; "once" - одноразовий, вимкнеться після дзвінка
+      if (doc.containsKey("days") && !readJsonInt(doc, "days", 0, ALARM_EVERY_DAY, days)) {
+        server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"days must be a weekday mask 0-127\"}");
+        return;
+      }
+      if (doc["once"] == true) {
+        days = 0;
       }
 
-      storage->saveAlarmSettings(alarmManager->getHour(), 
-                                 alarmManager->getMinute(), 
-                                 alarmManager->isEnabled());
-     
-      if (*currentScreen == SCREEN_SETTINGS) {
-        *needUpdateSetScreen = true;
+      // id видається тут, щоб клієнт міг звертатися до будильника одразу
+      msg.type = UI_MSG_ALARM_ADD;
+      msg.id = alarmManager->reserveId();
+      msg.hour = (uint8_t)hour;
+      msg.minute = (uint8_t)minute;
+      msg.days = (uint8_t)days;
+      msg.enabled = doc["enabled"] | true;
+      if (msg.id == 0) {
+        server.send(req, 409, "application/json", "{\"status\":\"error\",\"message\":\"Alarm list is full\"}");
+        return;
       }
-     
-      StaticJsonDocument<512> response;
-      response["hour"] = alarmManager->getHour();
-      response["minute"] = alarmManager->getMinute();
-      response["enabled"] = alarmManager->isEnabled();
-      response["triggered"] = alarmManager->isTriggered();
-      
-      String responseStr;
-      serializeJson(response, responseStr);
-      server.send(200, "application/json", responseStr);
     } else {
-      server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+      server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"Missing hour and minute\"}");
+      return;
     }
   } else {
-    StaticJsonDocument<512> doc;
-    doc["hour"] = alarmManager->getHour();
-    doc["minute"] = alarmManager->getMinute();
-    doc["enabled"] = alarmManager->isEnabled();
-    doc["triggered"] = alarmManager->isTriggered();
-   
-    String response;
-    serializeJson(doc, response);
-    server.send(200, "application/json", response);
+    StaticJsonDocument<ALARM_JSON_SIZE> doc;
+    JsonArray list = doc.createNestedArray("alarms");
+    for (uint8_t i = 0; i < count; i++) {
+      JsonObject item = list.createNestedObject();
+      item["id"] = rules[i].id;
+      item["hour"] = rules[i].hour;
+      item["minute"] = rules[i].minute;
+      item["days"] = rules[i].days;
+      item["enabled"] = (rules[i].flags & ALARM_ENABLED) != 0;
+      item["skip"] = (rules[i].flags & ALARM_SKIP_NEXT) != 0;
+      item["next"] = fireAt[i] != ALARM_NO_FIRE ? fireAt[i] : 0;
+    }
+    uint32_t next = alarmManager->getNextFire();
+    doc["next"] = next != ALARM_NO_FIRE ? next : 0;
+    doc["snoozedUntil"] = alarmManager->getSnoozeUntil();
+    doc["ringing"] = alarmManager->isRinging();
+    doc["max"] = ALARM_SLOTS;
+
+    sendJson(req, 200, doc);
+    return;
+  }
+
+  // Список оновиться, щойно задача UI обробить повідомлення; новий
+  // будильник матиме id з відповіді
+  if (!sendToUi(msg)) {
+    server.send(req, 503, "application/json", "{\"status\":\"error\",\"message\":\"Busy\"}");
+    return;
+  }
+  char reply[40];
+  if (msg.type == UI_MSG_ALARM_ADD) {
+    snprintf(reply, sizeof(reply), "{\"status\":\"success\",\"id\":%u}", msg.id);
+  } else {
+    strlcpy(reply, "{\"status\":\"success\"}", sizeof(reply));
   }
+  server.send(req, 202, "application/json", reply);
 }
 
-void WiFiManager::handleWeatherUpdate() {
-  weatherManager->fetchWeatherData();
+void WiFiManager::handleWeather(HttpRequest& req) {
+  // Власна копія: передній буфер може змінитись, поки документ ще живий
+  WeatherData data;
+  weatherManager->getSnapshot(data);
+  StaticJsonDocument<256> doc;
+  doc["description"] = (const char*)data.description;
+  doc["temperature"] = data.temperature;
+  doc["humidity"] = data.humidity;
+  doc["pressure"] = data.pressure;
+  doc["status"] = weatherManager->getJobStatusName();
+  doc["parseUs"] = weatherManager->getLastParseMicros();
+  doc["payloadBytes"] = weatherManager->getLastPayloadBytes();
   
-  StaticJsonDocument<512> doc;
-  doc["description"] = weatherManager->getDescription();
-  doc["temperature"] = weatherManager->getTemperature();
-  doc["humidity"] = weatherManager->getHumidity();
-  doc["pressure"] = weatherManager->getPressure();
-  doc["status"] = "updated";
-  
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  sendJson(req, 200, doc);
 }
 
-void WiFiManager::handleWeatherApiKey() {
-  if (server.method() == HTTP_POST) {
-    String body = server.arg("plain");
-    
-    StaticJsonDocument<256> doc;
-    DeserializationError error = deserializeJson(doc, body);
+void WiFiManager::handleWeatherUpdate(HttpRequest& req) {
+  // Відповідь - коли задача погоди опублікує результат, а до того
+  // з'єднання просто чекає в пулі й нічого не блокує
+  if (!hasWeatherKey) {
+    server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"No API key\"}");
+    return;
+  }
+
+  // Хто прийшов, поки інший уже чекає, отримує поточний стан
+  if (server.resume(weatherWaiter) != NULL) {
+    handleWeather(req);
+    return;
+  }
+
+  UiMessage msg = {};
+  msg.type = UI_MSG_WEATHER_REFRESH;
+  if (!sendToUi(msg)) {
+    server.send(req, 503, "application/json", "{\"status\":\"error\",\"message\":\"Busy\"}");
+    return;
+  }
+
+  weatherWaiterJobs = weatherManager->getJobsFinished();
+  weatherWaiter = server.defer(req);
+}
+
+void WiFiManager::handleWeatherApiKey(HttpRequest& req) {
+  if (req.method == HTTP_METHOD_POST) {
+    StaticJsonDocument<128> doc;
+    DeserializationError error = deserializeJson(doc, req.body);
     
-    if (!error && doc.containsKey("apiKey")) {
-      String apiKey = doc["apiKey"].as<String>();
-      weatherManager->setApiKey(apiKey);
-      storage->saveWeatherApiKey(apiKey);
-      
-      StaticJsonDocument<256> response;
-      response["status"] = "success";
-      response["apiKey"] = apiKey.substring(0, 8) + "...";
-      
-      String responseStr;
-      serializeJson(response, responseStr);
-      server.send(200, "application/json", responseStr);
-      
-      if (apiKey.length() > 0) {
-        weatherManager->fetchWeatherData();
+    if (!error && doc["apiKey"].is<const char*>()) {
+      // Рядок лежить у буфері запиту - розбір без копіювання
+      const char* apiKey = doc["apiKey"];
+
+      // Ключ застосовує, зберігає і запускає оновлення задача UI
+      UiMessage msg = {};
+      msg.type = UI_MSG_WEATHER_KEY;
+      strlcpy(msg.text, apiKey, sizeof(msg.text));
+      if (!sendToUi(msg)) {
+        server.send(req, 503, "application/json", "{\"status\":\"error\",\"message\":\"Busy\"}");
+        return;
       }
+      rememberWeatherKey(apiKey);
+      
+      char masked[sizeof(weatherKeyPrefix) + 3];
+      snprintf(masked, sizeof(masked), "%s...", weatherKeyPrefix);
+      doc.clear();
+      doc["status"] = "success";
+      doc["apiKey"] = (const char*)masked;
+      sendJson(req, 200, doc);
     } else {
-      server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid data\"}");
+      server.send(req, 400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid data\"}");
     }
   } else {
-    StaticJsonDocument<256> doc;
-    doc["hasKey"] = weatherManager->hasApiKey();
-    doc["apiKey"] = weatherManager->hasApiKey() ? 
-                    weatherManager->getApiKey().substring(0, 8) + "..." : "";
+    char masked[sizeof(weatherKeyPrefix) + 3] = "";
+    if (hasWeatherKey) {
+      snprintf(masked, sizeof(masked), "%s...", weatherKeyPrefix);
+    }
+    StaticJsonDocument<64> doc;
+    doc["hasKey"] = hasWeatherKey;
+    doc["apiKey"] = (const char*)masked;
     
-    String response;
-    serializeJson(doc, response);
-    server.send(200, "application/json", response);
+    sendJson(req, 200, doc);
+  }
+}
+
+void WiFiManager::handleRingtone(HttpRequest& req) {
+  if (req.method == HTTP_METHOD_DELETE) {
+    ringtoneStore->remove();
+  }
+
+  StaticJsonDocument<128> doc;
+  doc["hasRingtone"] = ringtoneStore->exists();
+  doc["durationMs"] = ringtoneStore->getDurationMs();
+  doc["underruns"] = alarmManager->getAudioUnderruns();
+
+  sendJson(req, 200, doc);
+}
+
+void WiFiManager::handleRingtoneUpload(HttpRequest& req, HttpBodyEvent event,
+                                       const uint8_t* data, size_t length) {
+  // Тіло - сирий PCM; частини стискаються одразу, кліп ніколи не лежить у RAM цілком.
+  // Сховище одне, тож паралельне завантаження з іншого з'єднання ігнорується.
+  if (event == HTTP_BODY_START) {
+    if (ringtoneUploader >= 0) return;
+    ringtoneUploader = req.slot;
+    ringtoneUploadOk = ringtoneStore->beginUpload();
+    return;
+  }
+  if (req.slot != ringtoneUploader) return;
+
+  switch (event) {
+    case HTTP_BODY_DATA:
+      if (ringtoneUploadOk) {
+        ringtoneUploadOk = ringtoneStore->appendPcm(data, length);
+      }
+      break;
+
+    case HTTP_BODY_END:
+      if (ringtoneUploadOk) {
+        ringtoneUploadOk = ringtoneStore->finishUpload();
+      }
+      break;
+
+    case HTTP_BODY_ABORT:
+      ringtoneStore->abortUpload();
+      ringtoneUploadOk = false;
+      ringtoneUploader = -1;
+      break;
+
+    default:
+      break;
+  }
+}
+
+void WiFiManager::handleRingtoneUploadDone(HttpRequest& req) {
+  if (req.slot != ringtoneUploader) {
+    server.send(req, 503, "application/json", "{\"status\":\"error\",\"message\":\"Busy\"}");
+    return;
   }
+  ringtoneUploader = -1;
+
+  StaticJsonDocument<128> doc;
+  doc["status"] = ringtoneUploadOk ? "success" : "error";
+  doc["durationMs"] = ringtoneStore->getDurationMs();
+
+  sendJson(req, ringtoneUploadOk ? 200 : 500, doc);
+}
+
+void WiFiManager::handleRingtonePlay(HttpRequest& req) {
+  alarmManager->previewRingtone();
+  server.send(req, 200, "application/json", "{\"status\":\"playing\"}");
+}
+
+// /history?from=&to=&res= - UTC-секунди; без from - остання доба,
+// без res - найдрібніший рівень, що покриває from. Точки
+// [час, Па, 0.1 C] читаються з журналу частинами, поки сокет їх приймає.
+void WiFiManager::handleHistory(HttpRequest& req) {
+  String value = req.arg("to");
+  uint32_t to = value.length() > 0 ? strtoul(value.c_str(), NULL, 10) : history->getLatestTime();
+  value = req.arg("from");
+  uint32_t from = value.length() > 0 ? strtoul(value.c_str(), NULL, 10) :
+                  (to > HISTORY_TIERS[0].retention ? to - HISTORY_TIERS[0].retention : 0);
+  uint32_t resolution = strtoul(req.arg("res").c_str(), NULL, 10);
+
+  if (from > to) {
+    server.send(req, 400, "application/json", "{\"error\":\"from after to\"}");
+    return;
+  }
+
+  HistoryQuery& query = historyQueries[req.slot];
+  history->open(query.cursor, from, to, resolution);
+  query.stage = HISTORY_QUERY_HEAD;
+  query.first = true;
+
+  server.sendChunked(req, 200, "application/json", [this, &query](char* buffer, size_t room) {
+    return writeHistory(query, buffer, room);
+  });
+}
+
+size_t WiFiManager::writeHistory(HistoryQuery& query, char* buffer, size_t room) {
+  size_t length = 0;
+
+  if (query.stage == HISTORY_QUERY_HEAD) {
+    length = snprintf(buffer, room, "{\"res\":%lu,\"points\":[", (unsigned long)query.cursor.step);
+    query.stage = HISTORY_QUERY_POINTS;
+  }
+
+  HistoryPoint points[HISTORY_READ_BATCH];
+  while (query.stage == HISTORY_QUERY_POINTS) {
+    // Лише стільки точок, скільки гарантовано вміститься
+    size_t fit = (room - length - 2) / HISTORY_POINT_TEXT_MAX;
+    if (fit == 0) break;
+
+    size_t count = history->read(query.cursor, points, min(fit, (size_t)HISTORY_READ_BATCH));
+    if (count == 0) {
+      memcpy(buffer + length, "]}", 2);
+      length += 2;
+      query.stage = HISTORY_QUERY_DONE;
+      break;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      length += snprintf(buffer + length, room - length, "%s[%lu,%ld,%d]",
+                         query.first ? "" : ",", (unsigned long)points[i].time,
+                         (long)points[i].pressurePa, points[i].temperatureDeci);
+      query.first = false;
+    }
+  }
+
+  return length;
 }
 
-void WiFiManager::handleNotFound() {
-  server.send(404, "text/plain", "404 - Page not found");
+void WiFiManager::handleNotFound(HttpRequest& req) {
+  server.send(req, 404, "text/plain", "404 - Page not found");
 }
\ No newline at end of file
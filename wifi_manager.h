@@ -2,41 +2,122 @@
 #define WIFI_MANAGER_H
 
 #include <WiFi.h>
-#include <WebServer.h>
 #include <ArduinoJson.h>
 #include <NTPClient.h>
 #include "config.h"
 #include "storage.h"
 #include "alarm.h"
 #include "weather.h"
+#include "ringtone.h"
+#include "display.h"
+#include "scheduler.h"
+#include "messages.h"
+#include "connection.h"
+#include "web_assets.h"
+#include "events.h"
+#include "http_server.h"
+#include "history.h"
+
+// /history, що віддається частинами: по одному на з'єднання
+enum HistoryQueryStage : uint8_t {
+  HISTORY_QUERY_HEAD = 0,
+  HISTORY_QUERY_POINTS,
+  HISTORY_QUERY_DONE
+};
+
+struct HistoryQuery {
+  HistoryCursor cursor;
+  HistoryQueryStage stage;
+  bool first;
+};
 
 class WiFiManager {
 private:
-  WebServer server;
+  HttpServer server;
   Storage* storage;
   AlarmManager* alarmManager;
   WeatherManager* weatherManager;
-  Screen* currentScreen;
-  bool* needUpdateSetScreen;
+  RingtoneStore* ringtoneStore;
+  DisplayManager* displayManager;
+  HistoryStore* history;
+  Scheduler* scheduler;
+  UiQueue* toUi;
+  NetQueue* fromUi;
+  TaskHandle_t taskHandle;
+  ConnectionManager link;
+  bool ringtoneUploadOk;
+  int8_t ringtoneUploader;   // слот з'єднання, що зараз завантажує, -1 - ніхто
+
+  // Статичні ресурси: скільки віддано і скільки коштував обробник
+  uint32_t assetRequests;
+  uint32_t assetNotModified;
+  uint32_t assetBytes;
+  uint32_t assetSourceBytes;
+  uint32_t lastAssetMicros;
+  uint32_t maxAssetMicros;
+
+  // Потік /events: останній надісланий знімок і час перевірки змін
+  EventStream events;
+  EventState lastEvent;
+  uint32_t lastEventCheck;
+
+  HistoryQuery historyQueries[HTTP_MAX_CONNECTIONS];
+
+  // /weather/update, що чекає кінця запиту погоди
+  HttpToken weatherWaiter;
+  uint32_t weatherWaiterJobs;
+
+  // Власні копії стану UI, які оновлюються повідомленнями
+  Screen shownScreen;
+  float sensorPressure;
+  float sensorTemperature;
+  bool hasWeatherKey;
+  char weatherKeyPrefix[9];
+
+  static void taskEntry(void* arg);
+  void taskLoop();
+  void drainMessages();
+  bool sendToUi(const UiMessage& msg);
+  void rememberWeatherKey(const char* key);
+  void sendJson(HttpRequest& req, int code, const JsonDocument& doc);
+  void serviceEvents();
+  void serviceDeferred();
+  void captureEventState(EventState& state);
+  size_t writeEvent(const EventState& state, uint8_t groups, char* buffer, size_t size);
   
-  void handleRoot();
-  void handleConnect();
-  void handleStatus();
-  void handleAlarm();
-  void handleWeatherUpdate();
-  void handleWeatherApiKey();
-  void handleNotFound();
+  void handleAsset(HttpRequest& req, const WebAsset& asset);
+  void handleConnect(HttpRequest& req);
+  void handleStatus(HttpRequest& req);
+  void handleAlarm(HttpRequest& req);
+  void handleWeather(HttpRequest& req);
+  void handleWeatherUpdate(HttpRequest& req);
+  void handleWeatherApiKey(HttpRequest& req);
+  void handleRingtone(HttpRequest& req);
+  void handleRingtoneUpload(HttpRequest& req, HttpBodyEvent event, const uint8_t* data, size_t length);
+  void handleRingtoneUploadDone(HttpRequest& req);
+  void handleRingtonePlay(HttpRequest& req);
+  void handleHistory(HttpRequest& req);
+  size_t writeHistory(HistoryQuery& query, char* buffer, size_t room);
+  void handleNotFound(HttpRequest& req);
 
 public:
   WiFiManager(Storage* stor, AlarmManager* alarm, WeatherManager* weather, 
-              Screen* screen, bool* needUpdate);
+              RingtoneStore* ringtones, DisplayManager* display, HistoryStore* log,
+              Scheduler* sched, UiQueue* uiQueue, NetQueue* netQueue);
   
   void begin();
+  // Переносить обслуговування сервера у власну задачу "net"
+  void startTask();
   void handleClient();
   
-  bool connectToWiFi(const String& ssid, const String& password);
+  // Лише запускає підключення до збережених мереж; далі ним керує
+  // автомат з handleClient(). false - жодної мережі не збережено.
+  bool connectToWiFi();
+  // Для setup(): чекає першого з'єднання не довше timeoutMs
+  bool waitForConnection(uint32_t timeoutMs);
   void startAP();
-  bool isConnected();
+  // Можна викликати з будь-якої задачі
+  bool isConnected() const { return link.isConnected(); }
 };
 
 #endif // WIFI_MANAGER_H
\ No newline at end of file